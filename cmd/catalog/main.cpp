@@ -0,0 +1,43 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file cmd/catalog/main.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief Exports the Gauge::NVectorCatalogs of the inputs surveyed by
+ * @c bin/parallel and @c bin/hybrid into the directory given as the first
+ * argument, which those surveys then take as their catalog directory.
+ */
+
+#include <Survey.h>
+
+int main(int argc, char **argv) {
+  const int D = 10, L = 1;
+  const int lower[L] = {2}, upper[L] = {26};
+  const std::string directory = (argc > 1) ? argv[1] : "catalogs/";
+
+  Gauge::Survey::Catalog(
+      // Input Factory
+      new Gauge::InputFactory::Range(lower, upper, L, D, Gauge::Input::kSUSY),
+      // Catalog Directory
+      directory
+    );
+
+  return 0;
+}
@@ -21,6 +21,7 @@
  * @date 05.08.2012
  */
 
+#include <NVectorCatalog.h>
 #include <Processor/ByGroup.h>
 #include <Survey.h>
 #include <Utility.h>
@@ -32,6 +33,9 @@ int main(int argc, char **argv) {
   const std::string root_dir = "/data/moored/test/L=" + std::to_string(L) + "/";
   Utility::Dir::Create(root_dir);
 
+  // Replay the NVectors from the catalogs exported by bin/catalog.
+  if (argc > 1) Gauge::NVectorCatalog::SetDirectory(argv[1]);
+
   Gauge::Survey::Parallel(
       // Required for MPI
       argc, argv,
@@ -0,0 +1,54 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file cmd/permutation/main.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief Surveys inputs of several layers of one order, building one model
+ * of each class of Gauge::GSOMatrix instances related by a permutation and
+ * change of sign of the basis vectors and tallying it by its multiplicity.
+ */
+
+#include <Processor/Statistics.h>
+#include <Survey.h>
+#include <Utility.h>
+
+int main(int argc, char **argv) {
+  const int D = 10, L = 3;
+  const int lower[L] = {2, 2, 2}, upper[L] = {2, 2, 2};
+  const int threads = (argc > 1) ? atoi(argv[1]) : 0;
+
+  const std::string root_dir = "results/permutation/L=" + std::to_string(L) + "/";
+  Utility::Dir::Create(root_dir);
+
+  Gauge::Survey::Threaded(
+      // Processors
+      { new Gauge::Process::Statistics(root_dir + "D=" + std::to_string(D)) },
+      // Geometry Factory
+      Gauge::GeometryFactory::PermutationFactory(),
+      // Input Factory
+      new Gauge::InputFactory::Range(lower, upper, L, D, Gauge::Input::kSUSY),
+      // Log File
+      root_dir + "D=" + std::to_string(D) + ".log",
+      // Builders, one per hardware thread by default
+      threads
+    );
+
+  return 0;
+}
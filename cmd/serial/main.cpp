@@ -10,6 +10,14 @@ int main(int argc, char** argv) {
   const std::string root_dir = "results/L=" + std::to_string(L) + "/";
   Utility::Dir::Create(root_dir);
 
+  // Replay the NVectors from catalogs in the given directory, exporting them
+  // first if they are not there yet.
+  if (argc > 1) {
+    Gauge::Survey::Catalog(
+        new Gauge::InputFactory::Range(lower, upper, L, D, Gauge::Input::kSUSY),
+        argv[1]);
+  }
+
   Gauge::Survey::Serial(
       // Processors
       { new Gauge::Process::ByGroup(root_dir + "/D=" + std::to_string(D) + "/", false) },
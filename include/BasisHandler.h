@@ -26,8 +26,13 @@
 #ifndef GAUGE_FRAMEWORK_BASISHANDLER_H
 #define GAUGE_FRAMEWORK_BASISHANDLER_H
 
+#include <inttypes.h>
+
+#include <vector>
+
 #include <Datatypes/Basis.h>
 #include <Datatypes/Input.h>
+#include <NVectorCatalog.h>
 #include <NVectorHandler.h>
 
 namespace Gauge {
@@ -35,6 +40,10 @@ namespace Gauge {
    * The Gauge::BasisHandler class is charged with actually constructing Basis
    * sets from the Gauge::NVector solutions, or any other method that may be
    * added to this class in the future.
+   *
+   * When a Gauge::NVectorCatalog for the orders and size of the Gauge::Input
+   * is found in the directory set by Gauge::NVectorCatalog::SetDirectory, the
+   * Gauge::NVectors are replayed from it rather than searched for.
    */
   class BasisHandler {
     public:
@@ -42,10 +51,12 @@ namespace Gauge {
        * Our default constructor does exactly what a default constructor should
        * do, initalize everything to an clean state.
        */
-      BasisHandler() {}
+      BasisHandler() {
+        filled_ = false; last_ = 0; next_ = 0; ordinal_ = 0; unchanged_ = 0;
+      }
       /*!
        * Because we are not dynamically allocating any memory, our destructor is
-       * trivial.
+       * trivial. The Gauge::BasisHandler::catalog_ unmaps itself.
        */
       ~BasisHandler() {}
       /*!
@@ -56,6 +67,20 @@ namespace Gauge {
        * vector set to construct.
        */
       void Setup(const Gauge::Input &input);
+      /*!
+       * This overload sets up the Gauge::BasisHandler to construct only the
+       * bases built from the Gauge::NVectors owned by the provided
+       * Gauge::NVectorSlice, allowing the bases of a single Gauge::Input to be
+       * generated in parallel.
+       *
+       * @param[in] input The Gauge::Input used to specify the type of basis
+       * vector set to construct.
+       * @param[in] slice The Gauge::NVectorSlice to construct bases from. It
+       * must have been split from the same Gauge::Input.
+       *
+       * @see Gauge::NVectorHandler::Split
+       */
+      void Setup(const Gauge::Input &input, const Gauge::NVectorSlice &slice);
       /*!
        * This method returns a pointer to the current basis.
        *
@@ -73,6 +98,44 @@ namespace Gauge {
        * constructed (@c true) or not.
        */
       bool NextBasis();
+      /*!
+       * This method counts the bases the plain Setup produces, including any
+       * that have already been produced. A catalog knows its count; otherwise
+       * the Gauge::NVectors are counted by Gauge::NVectorHandler::Count, once
+       * per Setup.
+       *
+       * @return The number of bases.
+       */
+      uint64_t Count();
+      /*!
+       * This accessor provides the ordinal of the basis the next call to
+       * Gauge::BasisHandler::NextBasis constructs, that is the number of bases
+       * produced or skipped since the plain Setup.
+       *
+       * @return The ordinal of the next basis.
+       */
+      uint64_t Position() const {
+        return catalog_.IsOpen() ? next_ : ordinal_;
+      }
+      /*!
+       * This method moves the handler forward, so that the next call to
+       * Gauge::BasisHandler::NextBasis constructs the basis with the provided
+       * ordinal, without constructing the ones before it. It is meant for the
+       * plain Setup; ordinals past the last basis exhaust the handler.
+       *
+       * @param[in] ordinal The ordinal to move to, which may not be behind
+       * Gauge::BasisHandler::Position.
+       */
+      void Seek(uint64_t ordinal);
+      /*!
+       * This accessor provides the number of leading vectors of the current
+       * basis that are unchanged since the previous one, so that products
+       * among them need not be recomputed. The first basis after a Setup has
+       * none.
+       *
+       * @return The number of unchanged basis vectors.
+       */
+      int unchanged() const { return unchanged_; }
 
     private:
       Gauge::NVectorHandler nvector_handler_;  /*!< An instance of
@@ -82,15 +145,49 @@ namespace Gauge {
       Basis basis_;                           /*!< An instance of Gauge::Basis
                                                 to store the most recently
                                                 constructed basis. */
+      Gauge::NVectorCatalog catalog_;         /*!< The catalog being replayed,
+                                                if any. */
+      bool filled_;                           /*!< A boolean flag specifying
+                                                whether the basis has been
+                                                filled since the last Setup. */
+      uint64_t last_;                         /*!< One past the last record of
+                                                the catalog to replay. */
+      uint64_t next_;                         /*!< The next record of the
+                                                catalog to replay. */
+      uint64_t ordinal_;                      /*!< The ordinal of the next
+                                                basis to search for. */
+      std::vector<uint64_t> starts_;          /*!< The ordinal of the first
+                                                basis descending from each
+                                                layer @c 0 solution, followed
+                                                by the count; empty until
+                                                counted. */
+      int unchanged_;                         /*!< The number of leading basis
+                                                vectors unchanged by the last
+                                                fill. */
       /*! We made the copy constructor private to prevent copying. */
       BasisHandler(const BasisHandler &other);
       /*! As with the copy constructor, the assignment operator is private. */
       BasisHandler &operator=(const BasisHandler &other);
       /*!
-       * This method uses the contents of the current Gauge::NVector solution
-       * and the a-matrix to fill the Gauge::Basis.
+       * This method opens the catalog for the provided Gauge::Input, if there
+       * is one, and initializes the Gauge::BasisHandler::basis_.
+       *
+       * @param[in] input The Gauge::Input the handler is setup with.
+       *
+       * @return A boolean flag specifying whether a catalog was opened.
+       */
+      bool SetupBasis(const Gauge::Input &input);
+      /*!
+       * This method uses the values of a Gauge::NVector, either the current
+       * solution or a catalog record, and the a-matrix to fill the
+       * Gauge::Basis.
+       *
+       * @param[in] values The values of the Gauge::NVector.
+       * @param[in] column The first value that differs from those the basis
+       * was last filled with; @c 0 fills the basis from scratch.
        */
-      void FillBasis();
+      template <class T>
+      void FillBasis(const T *values, int column);
   };
 }
 
@@ -0,0 +1,101 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file Datatypes/GSOSlice.h
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ * @brief The GSOSlice class declaration is defined.
+ *
+ * GSOSlice is a small descriptor for a disjoint piece of the Gauge::GSOMatrix
+ * instances that Gauge::GSOHandler produces for a single Gauge::Basis.
+ */
+
+#ifndef GAUGE_FRAMEWORK_GSOSLICE_H
+#define GAUGE_FRAMEWORK_GSOSLICE_H
+
+#include <inttypes.h>
+
+#include <Interfaces/Printable.h>
+#include <Interfaces/Serializable.h>
+
+namespace Gauge {
+  /*!
+   * @brief
+   * The Gauge::GSOSlice class describes a contiguous piece of the enumeration
+   * performed by Gauge::GSOHandler.
+   *
+   * The enumeration steps through the admissible choices of the lower-triangle
+   * elements as a mixed-radix odometer, so every combination of choices has a
+   * rank. A slice owns the Gauge::GSOMatrix instances whose ranks fall in the
+   * half-open range @f$ [begin, end) @f$. Enumerating a set of adjacent slices
+   * one after the other reproduces the sequential stream exactly.
+   *
+   * The position records how many ranks of the slice have already been passed,
+   * so that a partially processed slice can be resumed.
+   */
+  struct GSOSlice : public Gauge::Printable, public Gauge::Serializable {
+    uint64_t begin;     /*!< The first rank owned by the slice. */
+    uint64_t end;       /*!< One past the last rank owned by the slice. */
+    uint64_t position;  /*!< The number of ranks of the slice that have
+                          already been passed. */
+
+    /*!
+     * The default constructor creates an empty slice.
+     */
+    GSOSlice() : begin(0), end(0), position(0) {}
+    /*!
+     * The primary constructor sets the range of ranks. The position is
+     * initialized to @c 0.
+     *
+     * @param[in] begin The first rank owned by the slice.
+     * @param[in] end One past the last rank owned by the slice.
+     */
+    GSOSlice(uint64_t begin, uint64_t end) : begin(begin), end(end),
+      position(0) {}
+    /*!
+     * The equality operator determines the equality of two Gauge::GSOSlice
+     * instances.
+     *
+     * @param[in] other The Gauge::GSOSlice to which to compare @c this.
+     * @return A boolean signifying equality.
+     */
+    bool operator==(const Gauge::GSOSlice &other) const {
+      return begin == other.begin && end == other.end &&
+        position == other.position;
+    }
+    /*!
+     * The non-equality operator determines whether two Gauge::GSOSlice
+     * instances are not equal.
+     *
+     * @param[in] other The Gauge::GSOSlice to which to compare @c this.
+     * @return A boolean signifying that the instances are not equal.
+     */
+    bool operator!=(const Gauge::GSOSlice &other) const {
+      return !(*this == other);
+    }
+
+    // Printable Interface
+    virtual void PrintTo(std::ostream *out) const;
+
+    // Serializable Interface
+    virtual void SerializeWith(Gauge::Serializer *serializer) const;
+    virtual void DeserializeWith(Gauge::Serializer *serializer);
+  };
+}
+
+#endif
@@ -30,6 +30,8 @@
 #ifndef GAUGE_FRAMEWORK_GEOMETRY_H
 #define GAUGE_FRAMEWORK_GEOMETRY_H
 
+#include <inttypes.h>
+
 #include <Datatypes/Basis.h>
 #include <Datatypes/GSOMatrix.h>
 #include <Interfaces/Printable.h>
@@ -46,11 +48,14 @@ namespace Gauge {
   struct Geometry : public Gauge::Printable, public Gauge::Serializable {
     Gauge::Basis basis;           /*!< The basis describing the space. */
     Gauge::GSOMatrix gso_matrix;  /*!< The GSO projection matrix. */
+    uint64_t multiplicity;        /*!< The number of geometries, related
+                                    by permutations of the basis vectors,
+                                    this one stands for. */
     /*!
      * Our default constructor is trivial; everything is handled by other
      * constructors.
      */
-    Geometry() {}
+    Geometry() : multiplicity(1) {}
     /*!
      * This constructor uses the Gauge::Basis and Gauge::GSOMatrix instance
      * provided to construct the Gauge::Geometry.
@@ -61,6 +66,7 @@ namespace Gauge {
     Geometry(const Gauge::Basis &basis, const Gauge::GSOMatrix &gso_matrix) {
       this->basis = basis;
       this->gso_matrix = gso_matrix;
+      this->multiplicity = 1;
     }
     /*!
      * The Gauge::Geometry copy constructor copies the internal state of the
@@ -71,6 +77,7 @@ namespace Gauge {
     Geometry(const Gauge::Geometry &other) {
       basis = other.basis;
       gso_matrix = other.gso_matrix;
+      multiplicity = other.multiplicity;
     }
     /*!
      * Our destructor is trivial; there is no dynamic memory allocation here.
@@ -92,6 +99,7 @@ namespace Gauge {
       if (this != &other) {
         basis = other.basis;
         gso_matrix = other.gso_matrix;
+        multiplicity = other.multiplicity;
       }
       return *this;
     }
@@ -132,10 +140,12 @@ namespace Gauge {
     virtual void SerializeWith(Gauge::Serializer *serializer) const {
       serializer->WriteObject(basis);
       serializer->WriteObject(gso_matrix);
+      serializer->Write<uint64_t>(multiplicity);
     }
     virtual void DeserializeWith(Gauge::Serializer *serializer) {
       serializer->ReadObject(&basis);
       serializer->ReadObject(&gso_matrix);
+      serializer->Read<uint64_t>(&multiplicity);
     }
   };
 }
@@ -0,0 +1,126 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file Datatypes/NVectorSlice.h
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ * @brief The NVectorSlice class declaration is defined.
+ *
+ * NVectorSlice is a small descriptor for a disjoint piece of the
+ * Gauge::NVectorHandler search space.
+ */
+
+#ifndef GAUGE_FRAMEWORK_NVECTORSLICE_H
+#define GAUGE_FRAMEWORK_NVECTORSLICE_H
+
+#include <inttypes.h>
+
+#include <Interfaces/Printable.h>
+#include <Interfaces/Serializable.h>
+
+namespace Gauge {
+  /*!
+   * @brief
+   * The Gauge::NVectorSlice class describes a contiguous piece of the search
+   * performed by Gauge::NVectorHandler.
+   *
+   * The search is partitioned on the solutions of the layer @c 0
+   * Gauge::NVectorHandler::Solver. A slice owns every Gauge::NVector that
+   * descends from the layer @c 0 solutions with ordinals in the half-open range
+   * @f$ [begin, end) @f$. Since the search visits those solutions in order,
+   * enumerating a set of adjacent slices one after the other reproduces the
+   * sequential stream exactly.
+   *
+   * The position records how many Gauge::NVectors of the slice have already
+   * been produced, so that a partially processed slice can be resumed.
+   */
+  struct NVectorSlice : public Gauge::Printable, public Gauge::Serializable {
+    int layers;         /*!< The number of layers (a.k.a. number of orders). */
+    int *orders;        /*!< An array of orders of the search. */
+    int size;           /*!< The maximum size of the n-vectors. */
+    uint64_t begin;     /*!< The first layer @c 0 solution owned by the slice.*/
+    uint64_t end;       /*!< One past the last layer @c 0 solution owned by
+                          the slice. */
+    uint64_t position;  /*!< The number of Gauge::NVectors of the slice that
+                          have already been produced. */
+
+    /*!
+     * The default constructor creates an empty slice with no orders.
+     */
+    NVectorSlice() : layers(0), orders(NULL), size(0), begin(0), end(0),
+      position(0) {}
+    /*!
+     * The primary constructor copies the provided orders and sets the range of
+     * layer @c 0 solutions. The position is initialized to @c 0.
+     *
+     * @param[in] orders The array of orders.
+     * @param[in] layers The number of layers (a.k.a. the number of orders).
+     * @param[in] size The maximum size of the n-vectors.
+     * @param[in] begin The first layer @c 0 solution owned by the slice.
+     * @param[in] end One past the last layer @c 0 solution owned by the slice.
+     */
+    NVectorSlice(const int *orders, int layers, int size, uint64_t begin,
+        uint64_t end);
+    /*!
+     * The copy constructor copies the contents of the provided
+     * Gauge::NVectorSlice to a new instance.
+     *
+     * @param[in] other The Gauge::NVectorSlice to be copied.
+     */
+    NVectorSlice(const Gauge::NVectorSlice &other);
+    /*!
+     * Our destructor deletes the dynamically allocated array of orders.
+     */
+    virtual ~NVectorSlice() { if (orders != NULL) delete [] orders; }
+    /*!
+     * The assignment operator copies the contents of the provided
+     * Gauge::NVectorSlice into @c this.
+     *
+     * @param[in] other The Gauge::NVectorSlice to be copied.
+     * @return Returns a reference to this.
+     */
+    NVectorSlice &operator=(const Gauge::NVectorSlice &other);
+    /*!
+     * The equality operator determines the equality of two
+     * Gauge::NVectorSlice instances.
+     *
+     * @param[in] other The Gauge::NVectorSlice to which to compare @c this.
+     * @return A boolean signifying equality.
+     */
+    bool operator==(const Gauge::NVectorSlice &other) const;
+    /*!
+     * The non-equality operator determines whether two Gauge::NVectorSlice
+     * instances are not equal.
+     *
+     * @param[in] other The Gauge::NVectorSlice to which to compare @c this.
+     * @return A boolean signifying that the instances are not equal.
+     */
+    bool operator!=(const Gauge::NVectorSlice &other) const {
+      return !(*this == other);
+    }
+
+    // Printable Interface
+    virtual void PrintTo(std::ostream *out) const;
+
+    // Serializable Interface
+    virtual void SerializeWith(Gauge::Serializer *serializer) const;
+    virtual void DeserializeWith(Gauge::Serializer *serializer);
+  };
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file Datatypes/WorkUnit.h
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ * @brief The WorkUnit class declaration is defined.
+ *
+ * WorkUnit is a compact descriptor for a run of the Gauge::Geometry instances
+ * produced by a Gauge::GeometryFactory.
+ */
+
+#ifndef GAUGE_FRAMEWORK_WORKUNIT_H
+#define GAUGE_FRAMEWORK_WORKUNIT_H
+
+#include <inttypes.h>
+
+#include <Interfaces/Printable.h>
+#include <Interfaces/Serializable.h>
+
+namespace Gauge {
+  /*!
+   * @brief
+   * The Gauge::WorkUnit class describes the Gauge::Geometry instances whose
+   * ordinals fall in the half-open range @f$ [begin, end) @f$.
+   *
+   * An ordinal fixes the input, the Gauge::Basis and the rank of the
+   * Gauge::GSOMatrix within it, so a process holding the same inputs rebuilds
+   * the geometries of a unit with its own Gauge::GeometryFactory instead of
+   * receiving them. Ordinals that do not name a geometry are skipped.
+   *
+   * @see Gauge::GeometryFactory::Position
+   */
+  struct WorkUnit : public Gauge::Printable, public Gauge::Serializable {
+    uint64_t begin;     /*!< The first ordinal of the unit. */
+    uint64_t end;       /*!< One past the last ordinal of the unit. */
+
+    /*!
+     * The default constructor creates an empty unit.
+     */
+    WorkUnit() : begin(0), end(0) {}
+    /*!
+     * The primary constructor sets the range of ordinals.
+     *
+     * @param[in] begin The first ordinal of the unit.
+     * @param[in] end One past the last ordinal of the unit.
+     */
+    WorkUnit(uint64_t begin, uint64_t end) : begin(begin), end(end) {}
+    /*!
+     * The equality operator determines the equality of two Gauge::WorkUnit
+     * instances.
+     *
+     * @param[in] other The Gauge::WorkUnit to which to compare @c this.
+     * @return A boolean signifying equality.
+     */
+    bool operator==(const Gauge::WorkUnit &other) const {
+      return begin == other.begin && end == other.end;
+    }
+    /*!
+     * The non-equality operator determines whether two Gauge::WorkUnit
+     * instances are not equal.
+     *
+     * @param[in] other The Gauge::WorkUnit to which to compare @c this.
+     * @return A boolean signifying that the instances are not equal.
+     */
+    bool operator!=(const Gauge::WorkUnit &other) const {
+      return !(*this == other);
+    }
+
+    // Printable Interface
+    virtual void PrintTo(std::ostream *out) const;
+
+    // Serializable Interface
+    virtual void SerializeWith(Gauge::Serializer *serializer) const;
+    virtual void DeserializeWith(Gauge::Serializer *serializer);
+  };
+}
+
+#endif
@@ -26,7 +26,14 @@
 #ifndef GAUGE_FRAMEWORK_GSOHANDLER_H
 #define GAUGE_FRAMEWORK_GSOHANDLER_H
 
+// C Headers
+#include <inttypes.h>
+// C++ Headers
+#include <vector>
+
+// Gauge Framework Headers
 #include <Datatypes/Geometry.h>
+#include <Datatypes/GSOSlice.h>
 #include <Datatypes/Input.h>
 #include <Datatypes/Rational.h>
 #include <Datatypes/State.h>
@@ -36,14 +43,31 @@ namespace Gauge {
    * @brief
    * The Gauge::GSOHandler class deals with the initialization and generation of
    * modular invariant Gauge::GSOMatrix instances.
+   *
+   * Every element in column @c j of a Gauge::GSOMatrix is a multiple of
+   * \f$2/N_j\f$ in \f$(-1,1]\f$, where \f$N_j\f$ is the order of the
+   * corresponding basis vector. The enumeration works with the integer
+   * multiples, the phases, and only looks up the Gauge::Math::Rational
+   * elements when setting the Gauge::GSOMatrix.
    */
   class GSOHandler {
     public:
       /*!
        * The default constructor inializes the Gauge::GSOHandler::products_ and
        * Gauge::GSOHandler::orders_ to @c NULL.
+       *
+       * @param[in] permutations When @c true, only one Gauge::GSOMatrix of
+       * each class related by a permutation of the basis vectors, combined
+       * with a change of their signs, is produced.
+       *
+       * NOTE: Only the permutations and sign changes of basis vectors that a
+       * permutation of the fermions maps the Gauge::Basis to are used. A
+       * sign change redefines the phases, negating the elements of the row
+       * and column of the basis vector, and only a basis vector of order
+       * greater than @c 2 is changed by it. Other redefinitions of the phases
+       * are NOT identified.
        */
-      GSOHandler();
+      explicit GSOHandler(bool permutations = false);
       /*!
        * Because we are dynamically allocating arrays, i.e.
        * Gauge::GSOHandler::products_ and Gauge::GSOHandler::orders_, we need to
@@ -57,6 +81,42 @@ namespace Gauge {
        * @return The current Gauge::GSOMatrix.
        */
       const Gauge::GSOMatrix &GSOMatrix() const { return kij_; }
+      /*!
+       * Gauge::GSOHandler::Multiplicity returns the number of Gauge::GSOMatrix
+       * instances that the current one stands for. Without basis-permutation
+       * classes this is always @c 1.
+       *
+       * @return The size of the class of the current Gauge::GSOMatrix.
+       */
+      uint64_t Multiplicity() const { return multiplicity_; }
+      /*!
+       * Gauge::GSOHandler::Rank returns the rank of the current
+       * Gauge::GSOMatrix, its position in the enumeration of the current
+       * Setup.
+       *
+       * @return The rank of the current Gauge::GSOMatrix.
+       */
+      uint64_t Rank() const { return rank_; }
+      /*!
+       * Gauge::GSOHandler::Ranks returns the number of ranks of the current
+       * Setup. Every Gauge::GSOMatrix produced has a smaller rank, though
+       * not every rank is taken.
+       *
+       * @return The number of ranks.
+       */
+      uint64_t Ranks() const { return empty_ ? 0 : total_; }
+      /*!
+       * This static method bounds Gauge::GSOHandler::Ranks over every basis
+       * of the provided Gauge::Input, using nothing but its orders and SUSY
+       * type: modular invariance admits at most @f$ \gcd(N_i, N_j) @f$
+       * phases for each lower-triangle element.
+       *
+       * @param[in] input The Gauge::Input the bases are constructed for.
+       *
+       * @return The largest number of ranks a Setup may have, or @c 0 if it
+       * does not fit in 64 bits.
+       */
+      static uint64_t MaximumRanks(const Gauge::Input &input);
       /*!
        * Gauge::GSOHandler::NextGSOMatrix is called to generate the next
        * Gauge::GSOMatrix.
@@ -65,6 +125,44 @@ namespace Gauge {
        * created @c true, or @c false otherwise.
        */
       bool NextGSOMatrix();
+      /*!
+       * Count determines the exact number of Gauge::GSOMatrix instances the
+       * current Setup produces, including any that have already been
+       * produced, from the numbers of admissible choices of the elements.
+       * With basis-permutation classes, this is the sum of the
+       * multiplicities.
+       *
+       * @return The number of Gauge::GSOMatrix instances.
+       */
+      uint64_t Count() const;
+      /*!
+       * This method restricts the enumeration of the current Setup to the
+       * provided Gauge::GSOSlice, fast-forwarding past the ranks it has
+       * already passed. Several handlers set up with the same Gauge::Basis
+       * may each enumerate a different slice.
+       *
+       * @param[in] slice The Gauge::GSOSlice to enumerate.
+       */
+      void Seek(const Gauge::GSOSlice &slice);
+      /*!
+       * Split partitions the enumeration of the current Setup into the
+       * provided number of adjacent Gauge::GSOSlices, each owning as close to
+       * the same number of ranks as possible. Enumerating the slices in order
+       * reproduces the sequential stream of Gauge::GSOMatrix instances
+       * exactly.
+       *
+       * @param[in] parts The number of slices to construct.
+       * @param[out] slices A caller-allocated array of at least @c parts
+       * Gauge::GSOSlices.
+       */
+      void Split(int parts, Gauge::GSOSlice *slices) const;
+      /*!
+       * This method describes the current state of the enumeration as a
+       * Gauge::GSOSlice, so that it may be resumed later or elsewhere.
+       *
+       * @return The Gauge::GSOSlice being enumerated.
+       */
+      Gauge::GSOSlice Slice() const;
       /*!
        * This static method determines whether a state passes the GSO projection
        * or not.
@@ -80,6 +178,46 @@ namespace Gauge {
       static bool Project(const Gauge::Geometry &geometry,
                           const Gauge::State &state,
                           const int *coefficients);
+      /*!
+       * This static method applies the GSO projection to a batch of states of
+       * a single sector at once, using only integer arithmetic.
+       *
+       * @param[in] geometry The Gauge::Geometry in which the states were
+       * built.
+       * @param[in] states The values of the states, one after another, each
+       * as wide as the basis vectors.
+       * @param[in] count The number of states.
+       * @param[in] den The common denominator of the states.
+       * @param[in] coefficients The coefficients used to construct the
+       * Gauge::Sector that the states were built from.
+       * @param[out] survivors A caller-allocated array of @c count flags, set
+       * to @c 1 for the states that survive and @c 0 otherwise.
+       */
+      static void Project(const Gauge::Geometry &geometry, const int *states,
+                          int count, int den, const int *coefficients,
+                          char *survivors);
+      /*!
+       * This static method applies the GSO projections of up to @c 64
+       * Gauge::GSOMatrix instances, all paired with the same Gauge::Basis, to
+       * a batch of states of a single sector at once.
+       *
+       * @param[in] basis The Gauge::Basis the states were built from.
+       * @param[in] matrices The Gauge::GSOMatrix instances.
+       * @param[in] matrix_count The number of Gauge::GSOMatrix instances, at
+       * most @c 64.
+       * @param[in] states The values of the states, one after another, each
+       * as wide as the basis vectors.
+       * @param[in] count The number of states.
+       * @param[in] den The common denominator of the states.
+       * @param[in] coefficients The coefficients used to construct the
+       * Gauge::Sector that the states were built from.
+       * @param[out] survivors A caller-allocated array of @c count masks; bit
+       * @c m is set when the state survives the projection of matrix @c m.
+       */
+      static void Project(const Gauge::Basis &basis,
+                          const Gauge::GSOMatrix *matrices, int matrix_count,
+                          const int *states, int count, int den,
+                          const int *coefficients, uint64_t *survivors);
       /*!
        * Gauge::GSOHandler::Setup does all of the non-trivial setup required to
        * actually generate Gauge::GSOMatrix instances.
@@ -87,10 +225,53 @@ namespace Gauge {
        * @param[in] basis The Gauge::Basis that will be used to create the
        * @param[in] susy_type The type of susy the model should have.
        * Gauge::GSOMatrix instances.
+       * @param[in] unchanged The number of leading basis vectors unchanged
+       * since the previous call, whose products need not be recomputed.
+       *
+       * @see Gauge::BasisHandler::unchanged
        */
-      void Setup(const Gauge::Basis &basis, Gauge::Input::SUSYType susy_type);
+      void Setup(const Gauge::Basis &basis, Gauge::Input::SUSYType susy_type,
+                 int unchanged = 0);
 
     private:
+      /*!
+       * @brief An admissible phase of a lower-triangle element, with the
+       * phases it fixes.
+       */
+      struct Choice {
+        int element;  /*!< The phase of the lower-triangle element. */
+        int tnemele;  /*!< The phase of the upper-triangle element. */
+        int diagonal; /*!< The phase of the diagonal element, for elements in
+                        the first column. */
+      };
+
+      std::vector<int> automorphisms_;    /*!< The permutations of the rows
+                                            of the Gauge::GSOMatrix induced
+                                            by the symmetries of the
+                                            Gauge::Basis, other than the
+                                            identity, one after another. */
+      uint64_t begin_;                    /*!< The first rank of the
+                                            Gauge::GSOSlice being
+                                            enumerated. */
+      bool permutations_;                 /*!< A boolean flag specifying that
+                                            only one Gauge::GSOMatrix of each
+                                            class related by the symmetries
+                                            of the Gauge::Basis is
+                                            produced. */
+      Choice **choices_;                  /*!< The admissible choices of each
+                                            lower-triangle element, by row,
+                                            starting at
+                                            Gauge::GSOHandler::offsets_ for
+                                            each column. */
+      int **counts_;                      /*!< The number of admissible
+                                            choices of each lower-triangle
+                                            element. */
+      bool empty_;                        /*!< A boolean flag specifying that
+                                            some element has no admissible
+                                            choice. */
+      uint64_t end_;                      /*!< One past the last rank of the
+                                            Gauge::GSOSlice being
+                                            enumerated. */
       int extra_layers_;                  /*!< The number of extra layers that
                                             are atomatically added. */
       bool first_;                        /*!< A boolean flag specifying that
@@ -100,40 +281,160 @@ namespace Gauge {
                                             Gauge::GSOMatrix. */
       int *orders_;                       /*!< The dynamically allocated array
                                             of orders. */
-      Gauge::Math::Rational **products_;  /*!< The dynamically allocated matrix
+      Gauge::Math::Rational **fractions_; /*!< The reduced fractions of each
+                                            phase, by row, indexed from
+                                            Gauge::GSOHandler::Lowest. */
+      int **indices_;                     /*!< The current choice of each
+                                            lower-triangle element. */
+      uint64_t multiplicity_;             /*!< The size of the class of the
+                                            current Gauge::GSOMatrix. */
+      int *offsets_;                      /*!< The running sums of the
+                                            orders. */
+      int *ones_;                         /*!< For reduced SUSY, the choice in
+                                            the second column of each row
+                                            whose element is @c 1, or @c -1
+                                            if there is none. */
+      int **phases_;                      /*!< The phases of the elements of
+                                            the working Gauge::GSOMatrix. */
+      int **products_;                    /*!< The dynamically allocated matrix
                                             of dot products between basis
-                                            vectors. */
+                                            vectors, each multiplied by the
+                                            orders of its row and column. */
+      uint64_t rank_;                     /*!< The rank of the working
+                                            Gauge::GSOMatrix. */
       bool setup_;                        /*!< A boolean flag specifying that
                                             a call has been made to
                                             Gauge::GSOHandler::Setup. */
       Gauge::Input::SUSYType susy_type_;  /*!< A Gauge::Intput::SUSYType
                                             signifying what type of SUSY the
                                             models should have. */
+      std::vector<int> signs_;            /*!< The signs each of the
+                                            symmetries in
+                                            Gauge::GSOHandler::automorphisms_
+                                            gives the rows, laid out alike. */
+      uint64_t start_;                    /*!< The rank the enumeration
+                                            starts from. */
+      uint64_t total_;                    /*!< The number of combinations of
+                                            admissible choices. */
+      uint64_t **weights_;                /*!< The weight of each
+                                            lower-triangle element in the
+                                            rank, or @c 0 for those that are
+                                            not enumerated. */
       /*!
        * This method handles deallocating the memory allocated for the orders.
        */
       void ClearOrders();
       /*!
-       * This method clears the memory allocated for the products array.
+       * This method finds the permutations and sign changes of the basis
+       * vectors that a permutation of the fermions maps the Gauge::Basis to,
+       * and stores the permutations and signs of the rows they induce.
+       *
+       * @param[in] basis The Gauge::Basis being set up.
+       */
+      void ComputeAutomorphisms(const Gauge::Basis &basis);
+      /*!
+       * This method extends a partial permutation of the basis vectors, with
+       * their signs changed, that preserves their orders and products, one
+       * basis vector at a time.
+       *
+       * @param[in] basis The Gauge::Basis being set up.
+       * @param[in] source The Gauge::Basis with the signs changed.
+       * @param[in] signs The sign of each basis vector in @c source.
+       * @param[in] products The products of @c source, scaled as
+       * Gauge::GSOHandler::products_ is.
+       * @param[in] index The first basis vector left to map.
+       * @param[in,out] image The image of each basis vector mapped so far.
+       * @param[in,out] used Which basis vectors are images so far.
+       */
+      void ExtendAutomorphism(const Gauge::Basis &basis,
+                              const Gauge::Basis &source, const int *signs,
+                              const std::vector<std::vector<int> > &products,
+                              int index, int *image, bool *used);
+      /*!
+       * This method computes an element of the Gauge::GSOMatrix a symmetry of
+       * the Gauge::Basis maps the working one to.
+       *
+       * @param[in] map The rows of the symmetry.
+       * @param[in] signs The signs of the symmetry.
+       * @param[in] row The row of the lower-triangle element.
+       * @param[in] column The column of the lower-triangle element.
+       *
+       * @return The phase of the element.
+       */
+      int ImagePhase(const int *map, const int *signs, int row,
+                     int column) const;
+      /*!
+       * This method determines whether the working Gauge::GSOMatrix has the
+       * lowest rank of its class, and sets Gauge::GSOHandler::multiplicity_
+       * to the size of the class.
+       *
+       * @return @c true if the Gauge::GSOMatrix represents its class.
+       */
+      bool Representative();
+      /*!
+       * This method clears the memory allocated for the products and phases
+       * arrays.
        */
       void ClearProducts();
+      /*!
+       * This method sets the order of a row and fills in its reduced
+       * fractions.
+       *
+       * @param[in] row The row.
+       * @param[in] order The order of the row.
+       */
+      void SetupFractions(int row, int order);
+      /*!
+       * This method returns the lowest phase of the provided order, the one
+       * whose fraction is closest to @c -1 without reaching it.
+       *
+       * @param[in] order The order.
+       *
+       * @return The lowest phase; the highest is half the order.
+       */
+      static int Lowest(int order) { return -((order - 1) / 2); }
+      /*!
+       * This method cycles a phase into the range from
+       * Gauge::GSOHandler::Lowest to half the order, as Gauge::Math::Cycle
+       * does for fractions.
+       *
+       * @param[in] phase The phase.
+       * @param[in] order The order.
+       *
+       * @return The equivalent phase in range.
+       */
+      static int CyclePhase(int phase, int order) {
+        phase %= order;
+        if (phase > order / 2) return phase - order;
+        if (phase < Lowest(order)) return phase + order;
+        return phase;
+      }
+      /*!
+       * This method looks up the fraction of a phase in the provided column.
+       *
+       * @param[in] column The column of the element.
+       * @param[in] phase The phase of the element.
+       *
+       * @return The element as a reduced Gauge::Math::Rational.
+       */
+      const Gauge::Math::Rational &Fraction(int column, int phase) const {
+        return fractions_[column][phase - Lowest(orders_[column])];
+      }
       /*!
        * When setting the lower triangle of the Gauge::GSOMatrix, we must ensure
        * that the upper triangle can be set to a valid value. This method
        * computes the modular invariant value and returns @c true, or @c false
        * if one can't be found.
        *
-       * @param[in,out] tnemele A reference to the upper-triangle element.
+       * @param[in,out] tnemele A reference to the upper-triangle phase.
        * @param[in] row The index of the lower-triangle element.
        * @param[in] column The index of the lower-triangle element.
-       * @param[in] element A constant reference to the lower-triangle element.
+       * @param[in] element The phase of the lower-triangle element.
        *
        * @return A boolean flag signifying whether a valid upper-triangle was
        * found, @c true, or @c false otherwise.
        */
-      bool ComputeOffDiagonal(Gauge::Math::Rational &tnemele,
-                              int row, int column,
-                              const Gauge::Math::Rational &element);
+      bool ComputeOffDiagonal(int &tnemele, int row, int column, int element);
       /*!
        * When setting the lower triangle of the Gauge::GSOMatrix, we must ensure
        * that the diagonal value can be set to a valid value, if the lower
@@ -141,23 +442,45 @@ namespace Gauge {
        * modular invariant value and returns @c true, or @c false if one can't
        * be found.
        *
-       * @param[in,out] tnemele A reference to the upper-triangle element.
+       * @param[in,out] diagonal A reference to the diagonal phase.
        * @param[in] row The index of the lower-triangle element.
-       * @param[in] element A constant reference to the lower-triangle element.
+       * @param[in] element The phase of the lower-triangle element.
        *
        * @return A boolean flag signifying whether a valid upper-triangle was
        * found, @c true, or @c false otherwise.
        */
-      bool ComputeDiagonal(Gauge::Math::Rational &diagonal,
-                           int row, const Gauge::Math::Rational &element);
+      bool ComputeDiagonal(int &diagonal, int row, int element);
       /*!
        * This method computes the products between each of the basis vectors in
-       * the provided basis.
+       * the provided basis. Only the rows of the changed basis vectors are
+       * recomputed; the products among the unchanged ones are kept.
        *
        * @param[in] basis The basis that will be paired with the generated
        * GSO projection matrix.
+       * @param[in] unchanged The number of leading basis vectors unchanged
+       * since the products were last computed.
+       */
+      void ComputeProducts(const Gauge::Basis &basis, int unchanged);
+      /*!
+       * This method computes the admissible choices of every lower-triangle
+       * element in the rows of the changed basis vectors.
+       *
+       * @param[in] unchanged The number of leading basis vectors unchanged
+       * since the choices were last computed.
+       */
+      void ComputeChoices(int unchanged);
+      /*!
+       * This method determines whether a phase of a lower-triangle element is
+       * admissible, and if so, the phases it fixes.
+       *
+       * @param[in] row The row of the lower-triangle element.
+       * @param[in] column The column of the lower-triangle element.
+       * @param[in] element The phase of the lower-triangle element.
+       * @param[out] choice The choice, filled in when admissible.
+       *
+       * @return A boolean flag specifying whether the phase is admissible.
        */
-      void ComputeProducts(const Gauge::Basis &basis);
+      bool Admit(int row, int column, int element, Choice *choice);
       /*!
        * Gauge::GSOHandler::FirstGSOMatrix minimizes each of the lower triangle
        * elements and returns @c true if it does so sucessfully.
@@ -167,9 +490,9 @@ namespace Gauge {
        */
       bool FirstGSOMatrix();
       /*!
-       * Gauge::IncrementElement increments the lower triangle element at the
-       * provided location and sets the upper-triangle and diagonal via a call
-       * to Gauge::GSOHandler::SetElement if necessary.
+       * Gauge::IncrementElement advances the lower triangle element at the
+       * provided location to its next admissible choice, if any, and sets it
+       * via a call to Gauge::GSOHandler::SetElement.
        *
        * @param[in] row The row of the lower-triangle element to be incremented.
        * @param[in] column The column of the lower-triangle element to be
@@ -180,20 +503,8 @@ namespace Gauge {
        */
       bool IncrementElement(int row, int column);
       /*!
-       * This method takes care of minimizing a single lower-triangle element at
-       * the provided location and returns success.
-       *
-       * @param[in] row The row of the lower-triangle element to be incremented.
-       * @param[in] column The column of the lower-triangle element to be
-       * incremented.
-       *
-       * @return A boolean flag specifying whether the minimization
-       * succeeded, @c true, or not.
-       */
-      bool MinimizeElement(int row, int column);
-      /*!
-       * This method makes calls to Gauge::GSOHandler::IncrementElement and
-       * Gauge::GSOHandler::MinimizeElement so as to find the next
+       * This method advances the lower-triangle elements as a mixed-radix
+       * odometer over their admissible choices so as to find the next
        * Gauge::GSOMatrix.
        *
        * @return A boolean flag signifiying whether a new Gauge::GSOMatrix was
@@ -201,19 +512,54 @@ namespace Gauge {
        */
       bool Next();
       /*!
-       * This method does most of the heavy lifting. It set the lower-triangle,
-       * upper-triangle and, if the element is in the first column, the diagonal
-       * elements.
+       * This method completes the Gauge::GSOMatrix below the provided
+       * element, whose less significant elements are at their first choice,
+       * into the smallest one satisfying the SUSY constraints, if any.
+       *
+       * @param[in] row The row of the element.
+       * @param[in] column The column of the element.
+       *
+       * @return A boolean flag specifying whether a valid Gauge::GSOMatrix
+       * was found.
+       */
+      bool Complete(int row, int column);
+      /*!
+       * This method sets the lower-triangle, upper-triangle and, if the
+       * element is in the first column, the diagonal elements from one of the
+       * admissible choices.
        *
        * @param[in] row The row of the lower-triangle element.
        * @param[in] column The column of the lower-triangle element.
-       * @param[in] element The value of the lower-triangle element.
+       * @param[in] index The index of the choice.
+       */
+      void SetElement(int row, int column, int index);
+      /*!
+       * This method computes the phase a row of the Gauge::GSOMatrix
+       * contributes to the projection of the states of a sector, the sum of
+       * its elements weighted by the coefficients of the sector.
+       *
+       * @param[in] gso The Gauge::GSOMatrix.
+       * @param[in] row The row.
+       * @param[in] coefficients The coefficients of the sector.
+       *
+       * @return The phase.
+       */
+      static Gauge::Math::Rational ProjectionPhase(
+          const Gauge::GSOMatrix &gso, int row, const int *coefficients);
+      /*!
+       * This method fills in the basis vector a row of the Gauge::GSOMatrix
+       * projects with, including the extra layers.
+       *
+       * @param[in] basis The Gauge::Basis.
+       * @param[in] extra_layers The number of extra layers.
+       * @param[in] row The row of the Gauge::GSOMatrix.
+       * @param[out] vector A caller-allocated array as wide as the basis
+       * vectors.
        *
-       * @return A boolean flag signifying that the elements were set without
-       * problem.
+       * @return The order of the basis vector.
        */
-      bool SetElement(int row, int column,
-                      const Gauge::Math::Rational &element);
+      static int ProjectionVector(const Gauge::Basis &basis, int extra_layers,
+                                  int row, int *vector);
       /*!
        * From the dot-product of a state with a basis vector, this method
        * determines if the state survives the GSO projection from that basis
@@ -68,6 +68,31 @@ namespace Gauge {
        */
       const Gauge::Geometry *Geometry() const { return geometry_; }
       // Interface
+      /*!
+       * This accessor reports whether the ordinals of the inputs reached so
+       * far outgrew 64 bits. The geometries are still produced, but their
+       * ordinals are then all UINT64_MAX and no Gauge::Input past the last
+       * one that fits is skipped.
+       *
+       * @return @c true if the ordinals overflowed.
+       */
+      bool Overflow() const { return overflow_; }
+      /*!
+       * This static method constructs a Gauge::GeometryFactory like
+       * Gauge::GeometryFactory::SystematicFactory, except that of the
+       * Gauge::GSOMatrix instances related by a permutation of the basis
+       * vectors, combined with a change of their signs, only one is
+       * produced, with its Gauge::Geometry::multiplicity set to the number it
+       * stands for. This pays off for inputs with several layers of one
+       * order or layers of order greater than @c 2, and processors must weigh
+       * models by their multiplicity.
+       *
+       * NOTE: It is the end user's job to deallocate the memory allocated for
+       * the return Gauge::GeometryFactory.
+       *
+       * @return A pointer to the newly allocated Gauge::GeometryFactory.
+       */
+      static GeometryFactory *PermutationFactory();
       /*!
        * This static method provided a clean way of constructing generic
        * geometry factories in an expressive way. It takes a pointer to
@@ -100,6 +125,35 @@ namespace Gauge {
        * constructor, @c true, or not.
        */
       bool NextGeometry();
+      /*!
+       * This method returns the ordinal of the most recently constructed
+       * Gauge::Geometry. The ordinals are stable and increasing over the whole
+       * sequence of inputs, and depend only upon their shapes: each basis of
+       * a Gauge::Input owns Gauge::GSOHandler::MaximumRanks ordinals, in the
+       * order of the bases, and a Gauge::Geometry takes the one of its
+       * Gauge::GSOMatrix rank. Some ordinals are not taken, so contiguous
+       * ranges of ordinals partition the geometries. For many layers of
+       * large orders they may not fit in 64 bits, which
+       * Gauge::GeometryFactory::Overflow reports.
+       *
+       * @return The ordinal of the current Gauge::Geometry, or UINT64_MAX
+       * once the ordinals overflow.
+       */
+      uint64_t Position() const;
+      /*!
+       * This method moves the factory forward, so that the next call to
+       * Gauge::GeometryFactory::NextGeometry constructs the first
+       * Gauge::Geometry with an ordinal no smaller than the one provided.
+       * Inputs and bases that end before the ordinal are skipped by their
+       * counts, without constructing them or enumerating their
+       * Gauge::GSOMatrix instances.
+       *
+       * @see Gauge::BasisHandler::Seek
+       *
+       * @param[in] ordinal The ordinal to move to, which may not be behind
+       * the current Gauge::Geometry.
+       */
+      void Seek(uint64_t ordinal);
       /*!
        * This setup method allows the user to specify what the Gauge::Input
        * should be.
@@ -108,6 +162,18 @@ namespace Gauge {
        * generate.
        */
       void Setup(Gauge::InputFactory::Generic *input_factory);
+      /*!
+       * This method skips every Gauge::Geometry left in the current
+       * Gauge::Input, or in the next one between inputs, as
+       * Gauge::GeometryFactory::Seek does. Only the bases of that input are
+       * counted, so the ordinals can be dealt out an input at a time before
+       * any Gauge::Geometry of it is built; Gauge::GeometryFactory::Position
+       * is then one past its last ordinal.
+       *
+       * @return @c false if no Gauge::Input is left, or if the ordinals of
+       * the next one overflow.
+       */
+      bool SkipInput();
       /*!
        * This static method provided a clean way of constructing generic
        * geometry factories in an expressive way. It constructs
@@ -154,6 +220,14 @@ namespace Gauge {
        */
       GeometryFactory(Gauge::BasisHandler *basis_handler,
                       Gauge::GSOHandler *gso_handler);
+      /*!
+       * This method moves to the next Gauge::Input, setting up the
+       * Gauge::BasisHandler for it and counting its bases to find where its
+       * ordinals end.
+       *
+       * @return @c false if no Gauge::Input is left.
+       */
+      bool NextInput();
 
       Gauge::BasisHandler *basis_handler_;  /*!< The Gauge::BasisHandler to be
                                               used for the construction of
@@ -169,15 +243,32 @@ namespace Gauge {
                                               should be used to construct the
                                               Gauge::Input instances. */
 
+      uint64_t base_;                       /*!< The first ordinal of the
+                                              current Gauge::Input. */
+      uint64_t basis_;                      /*!< The ordinal of the current
+                                              basis within its Gauge::Input. */
+      uint64_t end_;                        /*!< One past the last ordinal of
+                                              the current Gauge::Input. */
       bool first_;                          /*!< This is a boolean flag used to
-                                              signify that there have been no
-                                              calls to
-                                              GeometryFactory::NextGeometry. */
+                                              signify that the next call to
+                                              GeometryFactory::NextGeometry
+                                              must move to the next
+                                              Gauge::Input. */
+      bool holding_;                        /*!< This flag signifies that the
+                                              Gauge::GSOHandler is enumerating
+                                              the current basis. */
       bool setup_;                          /*!< This flag signifies that the
                                               Gauge::GeometryFactory::Setup
                                               method has been called. */
       const Gauge::Input *input_;           /*!< The Gauge::Input specifying
                                               what models should be generated.*/
+      bool overflow_;                       /*!< This flag signifies that the
+                                              ordinals outgrew 64 bits. */
+      uint64_t ranks_;                      /*!< The number of ordinals owned by
+                                              each basis of the current
+                                              Gauge::Input. */
+      uint64_t target_;                     /*!< The smallest ordinal the next
+                                              Gauge::Geometry may have. */
   };
 }
 
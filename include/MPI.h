@@ -39,7 +39,10 @@ namespace Gauge {
     void SendTag(int processor, int exit_tag, MPI_Comm comm = MPI_COMM_WORLD);
     int ReceiveTag(int processor, MPI_Comm comm = MPI_COMM_WORLD);
 
+    // A raw travels as a single message, sized by the receiver with a probe.
     void SendRaw(Gauge::Raw &raw, int process, int tag);
+    // The raw must outlive the request.
+    void SendRaw(Gauge::Raw &raw, int process, int tag, MPI_Request *request);
     Gauge::Raw *ReceiveRaw(int process, int tag);
 
     template <class T>
@@ -49,6 +52,15 @@ namespace Gauge {
       delete data;
     }
 
+    // The returned raw is the caller's to delete once the request completes.
+    template <class T>
+    Gauge::Raw *Send(const T &message, int process, int tag,
+                     MPI_Request *request) {
+      Gauge::Raw *data = message.Serialize();
+      SendRaw(*data, process, tag, request);
+      return data;
+    }
+
     template <class T>
     bool Receive(int process, int tag, T *message) {
       Gauge::Raw *data = ReceiveRaw(process, tag);
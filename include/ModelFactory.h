@@ -26,6 +26,8 @@
 #ifndef GAUGE_FRAMEWORK_MODELFACTORY_H
 #define GAUGE_FRAMEWORK_MODELFACTORY_H
 
+#include <inttypes.h>
+
 #include <list>
 #include <memory>
 #include <string>
@@ -58,6 +60,17 @@ namespace Gauge {
        * @return A boolean flag signifying success or failure.
        */
       bool Build();
+      /*!
+       * This overload builds the model of one Gauge::Geometry of the batch
+       * provided to Gauge::ModelFactory::Setup(const Gauge::Geometry *const *,
+       * int). The massless states are found and projected for the whole batch
+       * on the first call.
+       *
+       * @param[in] index The index of the Gauge::Geometry in the batch.
+       *
+       * @return A boolean flag signifying success or failure.
+       */
+      bool Build(int index);
       /*!
        * This method returns a string representation of the Gauge::Group.
        *
@@ -112,6 +125,18 @@ namespace Gauge {
        * @param[in] geometry A pointer to the Gauge::Geometry to build from.
        */
       void Setup(const Gauge::Geometry *geometry);
+      /*!
+       * This overload sets the factory up to build the models of a batch of
+       * at most Gauge::ModelFactory::kBatch Gauge::Geometry instances that
+       * share their Gauge::Basis and differ only in their Gauge::GSOMatrix.
+       * The geometries are copied.
+       *
+       * @param[in] geometries An array of pointers to the geometries.
+       * @param[in] count The number of geometries.
+       */
+      void Setup(const Gauge::Geometry *const *geometries, int count);
+
+      static const int kBatch = 64; /*!< The largest batch of geometries. */
 
     private:
       /*!
@@ -147,6 +172,11 @@ namespace Gauge {
       bool built_;                            /*!< A flag signifying that the
                                                 model has been built whether
                                                 successfully or not. */
+      std::vector<Gauge::GSOMatrix> batch_;   /*!< The Gauge::GSOMatrix of each
+                                                geometry of the batch. */
+      std::vector<Gauge::State*> candidates_; /*!< The massless states of the
+                                                sector being constructed that
+                                                await the GSO projection. */
       const int **coefficients_;              /*!< A dnnamically allocated array
                                                 of integers representing the
                                                 coefficients used to construct
@@ -155,9 +185,24 @@ namespace Gauge {
       Gauge::Model model_;                    /*!< The constructed model. */
       int number_of_sectors_;                 /*!< An integer representation of
                                                 the number of sectors */
+      std::vector<uint64_t> masks_;           /*!< For each state of the pool,
+                                                the geometries of the batch
+                                                whose projections it
+                                                survives. */
+      std::vector<uint64_t> multiplicities_;  /*!< The
+                                                Gauge::Geometry::multiplicity
+                                                of each geometry of the
+                                                batch. */
       int *orders_;                           /*!< A dynamically allocated array
                                                 of integer representations of
                                                 the orders. */
+      std::vector<Gauge::State*> pool_;       /*!< The massless states that
+                                                survive the projection of some
+                                                geometry of the batch. */
+      bool pooled_;                           /*!< A flag signifying that the
+                                                pool has been constructed. */
+      std::vector<int> pool_sectors_;         /*!< The sector of each state of
+                                                the pool. */
       std::vector<std::unique_ptr<Gauge::Sector>> sectors_;
                                               /*!< A dynamically allocated array
                                                 of sectors. */
@@ -170,6 +215,16 @@ namespace Gauge {
        * Gauge::ModelFactory::coefficients_ array.
        */
       void ClearCoefficients();
+      /*!
+       * This method deletes the states of the pool.
+       */
+      void ClearPool();
+      /*!
+       * This method finds the massless states of every sector and projects
+       * them against the whole batch, keeping those that survive any
+       * projection in the pool.
+       */
+      void ConstructPool();
       /*!
        * This method does the garbage collection on the
        * Gauge::ModelFactory::groups_ list.
@@ -318,6 +373,13 @@ namespace Gauge {
        * This method sets the number of supersymmetries.
        */
       void SetSUSY();
+      /*!
+       * This method applies the GSO projection to the candidate states of a
+       * sector in one batch, keeping the survivors and deleting the rest.
+       *
+       * @param[in] sector The index of the sector.
+       */
+      void ProjectCandidates(int sector);
   };
 }
 
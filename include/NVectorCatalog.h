@@ -0,0 +1,184 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file include/NVectorCatalog.h
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief The Gauge::NVectorCatalog class is defined.
+ */
+
+#ifndef GAUGE_FRAMEWORK_NVECTORCATALOG_H
+#define GAUGE_FRAMEWORK_NVECTORCATALOG_H
+
+// C Headers
+#include <cassert>
+#include <inttypes.h>
+// C++ Headers
+#include <string>
+
+namespace Gauge {
+  /*!
+   * The Gauge::NVectorCatalog class provides read-only access to a catalog of
+   * the Gauge::NVectors produced by a Gauge::NVectorHandler, as written by
+   * Gauge::NVectorHandler::Export. The catalog is memory mapped, so opening it
+   * costs nothing beyond validating its header.
+   *
+   * A catalog consists of
+   *  - a Gauge::NVectorCatalog::Header,
+   *  - the orders, as 32-bit integers padded to a multiple of eight bytes,
+   *  - for every layer @c 0 solution, the index of the first Gauge::NVector
+   *    descending from it, followed by the total count, as 64-bit integers,
+   *  - and every Gauge::NVector, in order, one byte per value.
+   */
+  class NVectorCatalog {
+    public:
+      /*!
+       * @brief The fixed-size header of a catalog.
+       */
+      struct Header {
+        char magic[4];          /*!< Always "GNVC". */
+        uint32_t version;       /*!< The format version,
+                                  Gauge::NVectorCatalog::kVersion. */
+        uint32_t layers;        /*!< The number of orders. */
+        uint32_t size;          /*!< The size of the Gauge::NVectorHandler. */
+        uint32_t width;         /*!< The number of values in each
+                                  Gauge::NVector. */
+        uint32_t reserved;      /*!< Padding; always @c 0. */
+        uint64_t count;         /*!< The number of Gauge::NVectors. */
+        uint64_t ordinals;      /*!< The number of layer @c 0 solutions. */
+      };
+      /*! The version of the format written by this build. */
+      static const uint32_t kVersion = 1;
+
+      /*!
+       * The default constructor constructs a closed catalog.
+       */
+      NVectorCatalog();
+      /*!
+       * The destructor unmaps the catalog, if it is open.
+       */
+      ~NVectorCatalog();
+      /*!
+       * This method maps the catalog at the provided path and checks that it
+       * was written for the provided orders and size. Any previously opened
+       * catalog is closed first.
+       *
+       * @param[in] path The path to the catalog.
+       * @param[in] orders The orders the catalog must have been written for.
+       * @param[in] layers The length of the orders array.
+       * @param[in] size The size the catalog must have been written for.
+       *
+       * @return A boolean flag specifying whether the catalog is open (@c
+       * true), or whether it is missing or does not match (@c false).
+       */
+      bool Open(const std::string &path, const int *orders, int layers,
+          int size);
+      /*!
+       * This method unmaps the catalog.
+       */
+      void Close();
+      /*!
+       * This method determines whether a catalog is open.
+       *
+       * @return A boolean flag specifying whether a catalog is open.
+       */
+      bool IsOpen() const { return header_ != NULL; }
+      /*!
+       * This accessor returns the number of Gauge::NVectors in the catalog.
+       *
+       * @return The number of Gauge::NVectors.
+       */
+      uint64_t count() const { assert(IsOpen()); return header_->count; }
+      /*!
+       * This method returns the index of the first Gauge::NVector descending
+       * from the provided layer @c 0 solution. Ordinals past the last layer
+       * @c 0 solution are clamped to the count.
+       *
+       * @param[in] ordinal The ordinal of the layer @c 0 solution.
+       *
+       * @return The index of its first Gauge::NVector.
+       */
+      uint64_t First(uint64_t ordinal) const {
+        assert(IsOpen());
+        if (ordinal > header_->ordinals) ordinal = header_->ordinals;
+        return starts_[ordinal];
+      }
+      /*!
+       * This method provides constant access to the values of a
+       * Gauge::NVector in the catalog.
+       *
+       * @param[in] index The index of the Gauge::NVector.
+       *
+       * @return A pointer to its values, one byte each.
+       */
+      const unsigned char *Record(uint64_t index) const {
+        assert(IsOpen() && index < header_->count);
+        return records_ + index * header_->width;
+      }
+
+      /*!
+       * This method determines the name of the catalog for the provided orders
+       * and size within the directory set by
+       * Gauge::NVectorCatalog::SetDirectory.
+       *
+       * @param[in] orders An array of orders.
+       * @param[in] layers The length of the orders array.
+       * @param[in] size The size.
+       *
+       * @return The path to the catalog, or an empty string when no
+       * directory is set.
+       */
+      static std::string Path(const int *orders, int layers, int size);
+      /*!
+       * This method sets the directory in which catalogs are looked up by
+       * Gauge::BasisHandler. It should be called once, before any handlers
+       * are setup. An empty directory, the default, disables catalogs.
+       *
+       * @param[in] directory The directory of catalogs.
+       */
+      static void SetDirectory(const std::string &directory);
+      /*!
+       * This method computes the number of bytes a catalog occupies before
+       * its records.
+       *
+       * @param[in] layers The number of orders.
+       * @param[in] ordinals The number of layer @c 0 solutions.
+       *
+       * @return The offset of the first record.
+       */
+      static uint64_t RecordOffset(int layers, uint64_t ordinals);
+
+    private:
+      /*! The copy constructor is private to prevent copying. */
+      NVectorCatalog(const NVectorCatalog &other);
+      /*! As with the copy constructor, the assignment operator is private. */
+      NVectorCatalog &operator=(const NVectorCatalog &other);
+
+      static std::string directory_;  /*!< The directory of catalogs. */
+      void *data_;                    /*!< The start of the mapping. */
+      const Header *header_;          /*!< The header of the mapped catalog,
+                                        or @c NULL when closed. */
+      size_t length_;                 /*!< The length of the mapping. */
+      const unsigned char *records_;  /*!< The first record. */
+      const uint64_t *starts_;        /*!< The first Gauge::NVector of every
+                                        layer @c 0 solution. */
+  };
+}
+
+#endif
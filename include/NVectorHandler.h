@@ -32,7 +32,15 @@
 #ifndef GAUGE_FRAMEWORK_NVECTORHANDLER_H
 #define GAUGE_FRAMEWORK_NVECTORHANDLER_H
 
+#include <cassert>
+#include <inttypes.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
 #include <Datatypes/NVector.h>
+#include <Datatypes/NVectorSlice.h>
 
 namespace Gauge {
   /*!
@@ -41,6 +49,37 @@ namespace Gauge {
    */
   class NVectorHandler {
     public:
+      /*!
+       * The Gauge::NVectorHandler::StepResult enumeration specifies the
+       * outcome of a single call to Gauge::NVectorHandler::Step.
+       */
+      enum StepResult {
+        kContinue,  /*!< The search moved but has not yet found a solution. */
+        kSolution,  /*!< A new solution is available through
+                      Gauge::NVectorHandler::CurrentSolution. */
+        kExhausted  /*!< Every solution has been generated. */
+      };
+      /*!
+       * @brief A Gauge::NVectorHandler::Frame records the state of the search
+       * in a single layer.
+       *
+       * The search keeps one frame per layer and the frames from layer @c 0
+       * through Gauge::NVectorHandler::Depth form the stack that is walked by
+       * Gauge::NVectorHandler::Step.
+       */
+      struct Frame {
+        const Gauge::NVector *holder; /*!< The layer one solution of this
+                                        layer or @c NULL if the layer was
+                                        entered but not yet solved. */
+        uint64_t solutions;           /*!< The number of layer one solutions
+                                        found in this layer since Setup. */
+        uint64_t distributions;       /*!< The number of successful
+                                        redistributions of this layer since
+                                        Setup. */
+        uint64_t backtracks;          /*!< The number of times the search
+                                        returned to this layer from the layer
+                                        above it since Setup. */
+      };
       // Constructors
       /*!
        * The default constructor initializes ensures that the internal variables
@@ -71,6 +110,43 @@ namespace Gauge {
        * @return A boolean flag specifying whether a new solution was found.
        */
       bool NextSolution();
+      /*!
+       * Step advances the search by a single move: it solves, distributes or
+       * leaves the layer at the top of the frame stack. Repeatedly calling
+       * Step until it returns something other than
+       * Gauge::NVectorHandler::kContinue is exactly a call to
+       * Gauge::NVectorHandler::NextSolution, so a search may be paused and
+       * inspected between steps.
+       *
+       * @return The Gauge::NVectorHandler::StepResult of the move.
+       */
+      StepResult Step();
+      /*!
+       * This accessor provides the number of frames on the search stack, that
+       * is the index of the layer currently being solved plus one.
+       *
+       * @return The depth of the search stack.
+       */
+      int Depth() const { return current_ + 1; }
+      /*!
+       * This accessor provides constant access to the search frame of the
+       * provided layer.
+       *
+       * @param[in] layer The layer whose frame is requested.
+       *
+       * @return A constant reference to the Gauge::NVectorHandler::Frame.
+       */
+      const Frame &frame(int layer) const {
+        assert(setup_ && 0 <= layer && layer < layer_);
+        return frames_[layer];
+      }
+      /*!
+       * This accessor provides the total number of calls to
+       * Gauge::NVectorHandler::Step since the last Setup.
+       *
+       * @return The number of steps taken.
+       */
+      const uint64_t &steps() const { return steps_; }
       /*!
        * Setup does the nontrivial initialization and setup required to
        * correctly generate models.
@@ -83,15 +159,112 @@ namespace Gauge {
        * @param[in] layers The length of the orders array, that is the layer.
        */
       void Setup(const int *orders, int layers, int size);
+      /*!
+       * This overload sets up the Gauge::NVectorHandler to enumerate only the
+       * Gauge::NVectors owned by the provided Gauge::NVectorSlice. The search
+       * is moved past the solutions the slice has already produced by
+       * counting them, so resuming a slice deep into its range costs about as
+       * much as counting the part it skips, not enumerating it.
+       *
+       * @param[in] slice The Gauge::NVectorSlice to enumerate.
+       */
+      void Setup(const Gauge::NVectorSlice &slice);
+      /*!
+       * Split partitions the search space of the current Setup into the
+       * provided number of adjacent Gauge::NVectorSlices, each owning as close
+       * to the same number of layer @c 0 solutions as possible. Enumerating
+       * the slices in order reproduces the sequential stream of
+       * Gauge::NVectors exactly. When there are fewer layer @c 0 solutions
+       * than parts, the trailing slices are empty.
+       *
+       * @param[in] parts The number of slices to construct.
+       * @param[out] slices A caller-allocated array of at least @c parts
+       * Gauge::NVectorSlices.
+       */
+      void Split(int parts, Gauge::NVectorSlice *slices) const;
+      /*!
+       * This method describes the current state of the search as a
+       * Gauge::NVectorSlice, so that it may be resumed later or elsewhere.
+       * Its position counts the Gauge::NVectors produced so far.
+       *
+       * @return The Gauge::NVectorSlice being enumerated.
+       */
+      Gauge::NVectorSlice Slice() const;
+      /*!
+       * This method partitions the search space just as
+       * Gauge::NVectorHandler::Split does, except that the slices are balanced
+       * by the number of Gauge::NVectors they produce rather than by the
+       * number of layer @c 0 solutions they own.
+       *
+       * @see Gauge::NVectorHandler::Count(uint64_t,uint64_t)
+       *
+       * @param[in] parts The number of slices to construct.
+       * @param[out] slices A caller-allocated array of at least @c parts
+       * Gauge::NVectorSlices.
+       */
+      void SplitByWeight(int parts, Gauge::NVectorSlice *slices) const;
+      /*!
+       * Count determines the exact number of Gauge::NVectors the current
+       * Setup produces, including any that have already been produced. Only
+       * the layers below the last are walked; the last layer, where nearly
+       * all of the Gauge::NVectors are produced, is counted in closed form.
+       *
+       * @return The number of Gauge::NVectors.
+       */
+      uint64_t Count() const;
+      /*!
+       * This overload counts the Gauge::NVectors that descend from the layer
+       * @c 0 solutions with ordinals in @f$ [begin, end) @f$, that is the
+       * Gauge::NVectors produced by the Gauge::NVectorSlice with that range.
+       *
+       * @param[in] begin The first layer @c 0 solution to count.
+       * @param[in] end One past the last layer @c 0 solution to count.
+       *
+       * @return The number of Gauge::NVectors.
+       */
+      uint64_t Count(uint64_t begin, uint64_t end) const;
+      /*!
+       * This overload counts the Gauge::NVectors of the current Setup just as
+       * Gauge::NVectorHandler::Count does, and also provides the count of
+       * each layer @c 0 solution by its ordinal, so that an ordinal in the
+       * stream of Gauge::NVectors can be traced back to the layer @c 0
+       * solution it descends from. Trailing layer @c 0 solutions without any
+       * Gauge::NVectors may be left out.
+       *
+       * @param[out] weights The counts of the layer @c 0 solutions.
+       *
+       * @return The number of Gauge::NVectors.
+       */
+      uint64_t Count(std::vector<uint64_t> *weights) const;
+      /*!
+       * Export writes every Gauge::NVector of the current Setup, in order
+       * and regardless of any Gauge::NVectorSlice, to a
+       * Gauge::NVectorCatalog at the provided path so that later runs may
+       * replay them without searching. The search of this handler is left
+       * untouched.
+       *
+       * @param[in] path The path of the catalog to write.
+       *
+       * @return A boolean flag specifying whether the catalog was written.
+       */
+      bool Export(const std::string &path) const;
       /*!
        * This accessor provides constant access to the underlying A matrix
        * representing the un-squared and un-mixed modular invariance
        * constraints.
        *
-       * @return A constant double pointer to the underlying
-       * Gauge::NVector::amatrix_.
+       * @return A constant double pointer to the underlying, shared
+       * Gauge::NVectorHandler::amatrix_.
+       */
+      const int *const *amatrix() const { return amatrix_; }
+      /*!
+       * This accessor provides the first column of the current solution that
+       * may differ from the solution before it. Every column before it is
+       * unchanged. After a Setup, the first solution reports column @c 0.
+       *
+       * @return The first changed column of the current solution.
        */
-      const int **amatrix() const { return const_cast<const int**>(amatrix_); }
+      int changed() const { return changed_; }
       /*!
        * This accessor provides constant access to the conjugacy mapping.
        *
@@ -108,6 +281,33 @@ namespace Gauge {
        * @return A constant reference to the Gauge::NVectorHandler::avalue_.
        */
       const int& avalue() const { return avalue_; }
+    protected:
+      /*!
+       * This method takes care of the actual distribution of values in an
+       * array.
+       *
+       * Note that the array that this method takes is NOT a solution,
+       * but rather is a "compress" version of the segement begin delt with by
+       * DistributeInSegment.
+       *
+       * Only distributions that respect the conjugate ordering are generated:
+       * an element with a partner never exceeds the value of its partner. The
+       * distributions are visited in decreasing lexicographic order, and
+       * when they are exhausted the array is collapsed back onto its first
+       * element.
+       *
+       * @param[in] array The array whose values are being distributed.
+       * @param[in] size  The size of the array provided.
+       * @param[in] partners For each element, the index of the earlier
+       * element it is conjugate to, or @c -1.
+       * @param[out] first The index of the first element changed by a
+       * successful step; none before it are changed.
+       *
+       * @return A boolean flag specifying whether a distribution was found (@c
+       * true) or not.
+       */
+      static bool DistributeArray(int *array, int size, const int *partners,
+          int *first);
     private:
       /*!
        * @brief The Gauge::NVectorHandler::Solver class is designed to
@@ -187,8 +387,30 @@ namespace Gauge {
             return *this;
           }
 
+          /*!
+           * @brief The Gauge::NVectorHandler::Solver::Table struct records,
+           * for every end-segment of a solution of a given order, the smallest
+           * size the end-segment can have and still reach a given total.
+           *
+           * Row @f$ k @f$ describes the end-segment starting at element
+           * @f$ k @f$ and tabulates every total up to @f$ 22 c_k @f$, beyond
+           * which no end-segment of size at most @f$ 22 @f$ can reach. Entries
+           * that are unreachable hold a value greater than @f$ 22 @f$.
+           */
+          struct Table {
+            int width;              /*!< The number of rows in the table. */
+            int *limits;            /*!< The largest total tabulated in each
+                                      row. */
+            int *offsets;           /*!< The offset of each row in the sizes
+                                      array. */
+            unsigned char *sizes;   /*!< The smallest end-segment sizes, stored
+                                      row after row. */
+          };
+
           int *coefficients_;       /*!< A dynamically allocated array of
                                       coefficients. */
+          const Table *feasibility_;/*!< The feasibility table shared by all
+                                      solvers of the same order. */
           bool first_;              /*!< A boolean flag specifying whether it is
                                       the first time the
                                       Gauge::NVectorHandler::Solver has been
@@ -315,6 +537,52 @@ namespace Gauge {
            */
           int MaximizeSegment(Gauge::NVector &nvector, int index,
               int target_total, int maximum_size);
+          /*!
+           * This method determines whether the end-segment starting with the
+           * element at the provided index can reach the provided total without
+           * exceeding the provided size. It is a single table lookup.
+           *
+           * @see Gauge::NVectorHandler::Solver::FeasibilityTable
+           *
+           * @param[in] index The index to the first element of the segment.
+           * @param[in] target_total The total that the segment should have.
+           * @param[in] maximum_size The maximum size that the segment can have.
+           *
+           * @return A boolean flag specifying whether such a segment exists.
+           */
+          bool Feasible(int index, int target_total, int maximum_size) const {
+            return target_total <= feasibility_->limits[index] &&
+              feasibility_->sizes[feasibility_->offsets[index] + target_total]
+                <= maximum_size;
+          }
+          /*!
+           * This method returns the feasibility table for the provided order,
+           * building it the first time that order is requested. The tables
+           * are shared by every Gauge::NVectorHandler::Solver in the process
+           * and are never freed.
+           *
+           * @param[in] order The order of the modular invariance constraint.
+           *
+           * @return A constant reference to the table.
+           */
+          static const Table &FeasibilityTable(int order);
+      };
+      /*!
+       * @brief A Gauge::NVectorHandler::Tables gives writable access to a set
+       * of shared tables while Gauge::NVectorHandler::SetupTables builds it.
+       *
+       * Each pointer aliases the read-only member of the same name; once the
+       * tables are built they are only reached through those members.
+       */
+      struct Tables {
+        int **amatrix;      /*!< Gauge::NVectorHandler::amatrix_ */
+        int *barriers;      /*!< Gauge::NVectorHandler::barriers_ */
+        int *conjugates;    /*!< Gauge::NVectorHandler::conjugates_ */
+        int **constraints;  /*!< Gauge::NVectorHandler::constraints_ */
+        int *moduli;        /*!< Gauge::NVectorHandler::moduli_ */
+        int *multiplicity;  /*!< Gauge::NVectorHandler::multiplicity_ */
+        int *orders;        /*!< Gauge::NVectorHandler::orders_ */
+        int *replication;   /*!< Gauge::NVectorHandler::replication_ */
       };
       /*!
        * The Gauge::NVectorHandler copy constructor is both trivial and private.
@@ -328,41 +596,81 @@ namespace Gauge {
        */
       NVectorHandler &operator=(const NVectorHandler &other) { return *this; }
 
-      int **amatrix_;           /*!< A dynamically allocated, 2D array
+      const int *const *amatrix_; /*!< A shared, read-only, 2D array
                                   representing the unsquared coefficients of the
                                   modular invariance constraints. */
       int avalue_;              /*!< An integer representation of the avalue,
                                   that is @f$ A = \prod_{i = 1}^L N_i @f$ */
-      int *barriers_;           /*!< A dynamically allocated array representing
+      const int *barriers_;     /*!< A shared, read-only array representing
                                   the column of the matrix such it, and all
                                   following columns, are @f$ 0 @f$. The index is
                                   the row of the amatrix_ in question. */
-      int *conjugates_;         /*!< A dynamically allocated array specifying
+      const int *conjugates_;   /*!< A shared, read-only array specifying
                                   which columns of the a-matrix are conjugates
                                   (i.e.  the coefficients of the modular
                                   invariance constraints specified by those
-                                  columns are the same). */
-      int **constraints_;       /*!< A dynamically allocated, 2D array
+                                  columns are the same). Conjugate columns
+                                  always lie in the same segment of their
+                                  equation, which is checked when the table
+                                  is built. */
+      int changed_;             /*!< The first column of the current solution
+                                  that may differ from the previous one. */
+      const int *const *constraints_; /*!< A shared, read-only, 2D array
                                   representing the coefficients of the mixed
                                   modular invariance constraints. */
+      uint64_t begin_;          /*!< The first layer @c 0 solution that is
+                                  enumerated. */
       int current_;             /*!< An integer representing the current layer
-                                  we are solving. */
-      const NVector **holders_; /*!< A dynamically allocated array of
-                                  Gauge::NVector pointers. These pointers point
-                                  the the internal solutions in the
-                                  corresponding Gauge::NVectorHandler::Solver.*/
+                                  we are solving, the top of the frame stack.*/
+      bool counting_;           /*!< A boolean flag specifying whether the
+                                  search tallies the last layer rather than
+                                  entering it. Only set on the scratch
+                                  handlers of
+                                  Gauge::NVectorHandler::CountRange and
+                                  while Gauge::NVectorHandler::Skip walks. */
+      int *container_;          /*!< A dynamically allocated scratch array
+                                  holding the segment being distributed by
+                                  Gauge::NVectorHandler::DistributeInSegment.
+                                  It is as large as the largest segment. */
+      bool distribute_;         /*!< A boolean flag specifying whether the
+                                  next step should begin by distributing the
+                                  solution of the current layer. */
+      Frame *frames_;           /*!< A dynamically allocated array of
+                                  Gauge::NVectorHandler::Frame, one for each
+                                  layer. The holders point to the internal
+                                  solutions in the corresponding
+                                  Gauge::NVectorHandler::Solver. */
+      uint64_t end_;            /*!< One past the last layer @c 0 solution
+                                  that is enumerated. */
+      bool exhausted_;          /*!< A boolean flag specifying whether the
+                                  search has run out, after which every step
+                                  reports Gauge::NVectorHandler::kExhausted. */
       int layer_;               /*!< An integer representation of the layer of
                                   the model to be build. */
-      int *moduli_;             /*!< A dynamically allocated array representing
+      const int *moduli_;       /*!< A shared, read-only array representing
                                   the moduli of the modular invariance
                                   constraint equations. */
-      int *multiplicity_;       /*!< A dynamically allocated array containing
+      const int *multiplicity_; /*!< A shared, read-only array containing
                                   the multiplicities for each layer. */
-      int *orders_;             /*!< A dynamically allocated array representing
+      const int *orders_;       /*!< A shared, read-only array representing
                                   the order of the models build. (Provided at
                                   Setup) */
-      int *replication_;        /*!< A dynamically allocated array representing
+      int *partners_;           /*!< A dynamically allocated scratch array
+                                  holding the conjugate partners of the
+                                  elements of
+                                  Gauge::NVectorHandler::container_. */
+      uint64_t position_;       /*!< The number of Gauge::NVectors found
+                                  since the last call to
+                                  Gauge::NVectorHandler::Setup, including those
+                                  skipped to resume a slice. */
+      const int *replication_;  /*!< A shared, read-only array representing
                                   the replication for each layer. */
+      int *residues_;           /*!< A dynamically allocated, flattened 2D
+                                  array of the running values of the mixed
+                                  constraints. The element
+                                  @f$ L \cdot e + i @f$ holds the value of the
+                                  mixed constraint between equation @f$ e @f$
+                                  and layer @f$ i > e @f$. */
       bool setup_;              /*!< A boolean flag specifying whether the
                                   Gauge::NVectorHandler is setup. */
       int size_;                /*!< An integer representation of the size
@@ -375,6 +683,18 @@ namespace Gauge {
       Solver *solvers_;         /*!< A dynamically allocated array of
                                   Gauge::NVectorHandler::Solver, one for each
                                   layer. */
+      uint64_t skip_;           /*!< The tally Gauge::NVectorHandler::Skip
+                                  is counting up to, or @c UINT64_MAX. */
+      uint64_t steps_;          /*!< The number of steps taken since the last
+                                  call to Gauge::NVectorHandler::Setup. */
+      int touched_;             /*!< The first column changed since the last
+                                  solution was found. */
+      uint64_t tally_;          /*!< The number of Gauge::NVectors counted
+                                  so far in counting mode. */
+      std::map<int,uint64_t> tallies_; /*!< The memoized counts of
+                                  Gauge::NVectorHandler::CountLastLayer,
+                                  keyed by its solver arguments and the
+                                  conjugate order below it. */
 
 
       /*!
@@ -404,25 +724,26 @@ namespace Gauge {
        */
       bool DistributeInSegment(int equation, int segment);
       /*!
-       * This method takes care of the actual distribution of values in an
-       * array.
-       *
-       * Note that the array that this method takes is NOT a solution,
-       * but rather is a "compress" version of the segement begin delt with by
-       * DistributeInSegment.
-       *
-       * @param[in] array The array whose values are being distributed.
-       * @param[in] size  The size of the array provided.
+       * This method checks the invariant that
+       * Gauge::NVectorHandler::DistributeInSegment relies upon: every pair of
+       * conjugate columns lies in a single segment of a single equation, so
+       * that the conjugate ordering of a pair can be enforced by distributing
+       * that segment alone. A table that breaks it terminates the program via
+       * a C assertion.
        *
-       * @return A boolean flag specifying whether a distribution was found (@c
-       * true) or not.
+       * @see Gauge::NVectorHandler::SetupConjugates
        */
-      bool DistributeArray(int *array, int size);
+      void CheckConjugates() const;
       /*!
        * Once we have solutions that satify the un-mixed modular invariance
        * constraints, this method determines if it satisfies the mixed
        * constraints.
        *
+       * The check is made against the running
+       * Gauge::NVectorHandler::residues_, so it costs a single modulus per
+       * constraint. When compiled with @c GAUGE_DEBUG the residues are also
+       * compared with a full recomputation.
+       *
        * @param[in] equation The layer-one equation whose mixed constraints are
        * to be validated.
        *
@@ -430,20 +751,87 @@ namespace Gauge {
        * mixed constraints in question.
        */
       bool IsValid(int equation);
+      /*!
+       * This method computes the value of the mixed constraint between the
+       * provided equation and a later layer from scratch.
+       *
+       * @param[in] equation The layer-one equation of the constraint.
+       * @param[in] layer The later layer of the constraint.
+       *
+       * @return The dot product @f$ \sum_j n_j a_{ej} a_{ij} @f$ over the
+       * columns preceeding the barrier of the equation.
+       */
+      int Residue(int equation, int layer) const;
+      /*!
+       * This method changes a single element of the current solution and
+       * updates the running residues of the provided equation to match.
+       *
+       * @param[in] equation The equation whose residues are updated.
+       * @param[in] column The column of the solution to change.
+       * @param[in] delta The amount by which to change it.
+       */
+      void ApplyDelta(int equation, int column, int delta);
       /*!
        * When a new layer one solution is found, we need to fill the current
        * solution with its values. This method takes care of that.
        */
       void FillSolution();
       /*!
-       * This method does exactly what one would expect: it generates the next
-       * valid NVector solution to the modular invariance constraints.
+       * This method moves the search up to the next layer, just as
+       * Gauge::NVectorHandler::PushFrame does, unless it is counting and the
+       * next layer is the last one.
+       *
+       * @see Gauge::NVectorHandler::counting_
+       *
+       * @return A boolean flag specifying whether a frame was pushed.
+       */
+      bool Descend();
+      /*!
+       * This method counts the Gauge::NVectors the last layer produces on top
+       * of the current solution of the layer below it. It is only called by
+       * Gauge::NVectorHandler::Descend with the search at the last layer.
        *
-       * @param[in] distribute Whether or not to distribute the solution
+       * @return The number of Gauge::NVectors.
+       */
+      uint64_t CountLastLayer();
+      /*!
+       * This method counts the Gauge::NVectors that descend from the layer
+       * @c 0 solutions with ordinals in @f$ [begin, end) @f$.
+       *
+       * @param[in] begin The first layer @c 0 solution to count.
+       * @param[in] end One past the last layer @c 0 solution to count.
+       * @param[out] weights When not @c NULL, this receives the count for
+       * every layer @c 0 ordinal, indexed by ordinal. Trailing ordinals
+       * without any Gauge::NVectors may be missing.
+       *
+       * @return The number of Gauge::NVectors.
+       */
+      uint64_t CountRange(uint64_t begin, uint64_t end,
+          std::vector<uint64_t> *weights) const;
+      /*!
+       * This method moves the search past the provided number of
+       * Gauge::NVectors without producing them. The search walks in counting
+       * mode, tallying the last layer in closed form, until the batch of the
+       * last layer holding the next Gauge::NVector; only that batch is
+       * entered and stepped through. With a single layer there is no layer
+       * below the last to count with, and the Gauge::NVectors are stepped
+       * over one by one.
+       *
+       * @param[in] count The number of Gauge::NVectors to skip.
+       */
+      void Skip(uint64_t count);
+      /*!
+       * This method pushes a new frame onto the search stack, that is it moves
+       * the search up to the next layer and sets up its equation.
        *
-       * @return A boolean flag signifying success (@c true) or failure.
+       * @see Gauge::NVectorHandler::SetupEquation
+       */
+      void PushFrame();
+      /*!
+       * This method pops the top frame from the search stack, returning the
+       * search to the layer below so that its solution is distributed next.
        */
-      bool FindNextSolution(bool distribute);
+      void PopFrame();
       /*!
        * Because of the way the algorithm was designed, we solve the layer one
        * constraints independently and this allows us to construct the
@@ -464,8 +852,10 @@ namespace Gauge {
        * @see Gauge::NVectorHandler::amatrix_
        * @see Gauge::NVectorHandler::barriers_
        * @see Gauge::NVectorHandler::Setup
+       *
+       * @param[in] tables The tables being built.
        */
-      void SetupAMatrix();
+      void SetupAMatrix(const Tables &tables);
       /*!
        * We determine which n-values are conjugate to one another. That is, we
        * which n-values correspond to equal coefficients in the modular
@@ -473,8 +863,10 @@ namespace Gauge {
        *
        * @see Gauge::NVectorHandler::conjugates_
        * @see Gauge::NVectorHandler::Setup
+       *
+       * @param[in] tables The tables being built.
        */
-      void SetupConjugates();
+      void SetupConjugates(const Tables &tables);
       /*!
        * This method uses the Gauge::NVectorHandler::orders_ array to determine
        * what the moduli for the modular invariance constraint equations are as
@@ -484,8 +876,10 @@ namespace Gauge {
        * @see Gauge::NVectorHandler::moduli_
        * @see Gauge::NVectorHandler::orders_
        * @see Gauge::NVectorHandler::Setup
+       *
+       * @param[in] tables The tables being built.
        */
-      void SetupConstraints();
+      void SetupConstraints(const Tables &tables);
       /*!
        * This method does the nontrivial setup of the current solver. This
        * method should be called each time Gauge::NVectorHandler::current_ is
@@ -496,24 +890,60 @@ namespace Gauge {
        */
       void SetupEquation();
       /*!
-       * This method allocates the memory for and initializes the
+       * This method determines the arguments of the
+       * Gauge::NVectorHandler::Solver of the current layer from the columns
+       * below it.
+       *
+       * @param[out] maximum_size The size left for the current layer.
+       * @param[out] minimum_total The total the current layer must reach.
+       */
+      void SolverBounds(int *maximum_size, int *minimum_total) const;
+      /*!
+       * This method recomputes the running residues of the current equation.
+       * It is called whenever the search enters a layer.
+       *
+       * @see Gauge::NVectorHandler::residues_
+       * @see Gauge::NVectorHandler::SetupEquation
+       */
+      void SetupResidues();
+      /*!
+       * This method initializes the
        * Gauge::NVectorHandler::multiplicity_ and
        * Gauge::NVectorHandler::replication_ arrays.
        *
        * @see Gauge::NVectorHandler::multiplicity_
        * @see Gauge::NVectorHandler::replicaiton_
        * @see Gauge::NVectorHandler::Setup
+       *
+       * @param[in] tables The tables being built.
        */
-      void SetupMultiplicities();
+      void SetupMultiplicities(const Tables &tables);
       /*!
-       * This method initializes the Gauge::NVectorHandler::solvers_ array.
-       * Essentially, each element is a Gauge::NVectorHandler::Solver, one for
-       * each layer.
+       * This method initializes the Gauge::NVectorHandler::solvers_ and
+       * Gauge::NVectorHandler::frames_ arrays. Essentially, each element is
+       * a Gauge::NVectorHandler::Solver or Gauge::NVectorHandler::Frame, one
+       * for each layer. It also allocates the scratch arrays used to
+       * distribute the segments.
        *
+       * @see Gauge::NVectorHandler::container_
+       * @see Gauge::NVectorHandler::frames_
        * @see Gauge::NVectorHandler::solvers_
        * @see Gauge::NVectorHandler::Setup
        */
       void SetupSolvers();
+      /*!
+       * This method points the setup tables of this Gauge::NVectorHandler at
+       * the process-wide copy for the provided orders, building it first if
+       * no handler has needed it yet. Building is thread safe.
+       *
+       * @see Gauge::NVectorHandler::SetupAMatrix
+       * @see Gauge::NVectorHandler::SetupConjugates
+       * @see Gauge::NVectorHandler::SetupConstraints
+       * @see Gauge::NVectorHandler::SetupMultiplicities
+       *
+       * @param[in] orders An array of Gauge::NVectorHandler::layer_ orders.
+       */
+      void SetupTables(const int *orders);
       /*!
        * This method determines what the coefficients of the
        * Gauge::NVectorHandler::amatrix_ should be based on the row.
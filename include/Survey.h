@@ -30,7 +30,38 @@
 
 namespace Gauge {
   namespace Survey {
-    void Parallel(
+    /*!
+     * This function exports a Gauge::NVectorCatalog for every Gauge::Input of
+     * the factory into the provided directory, skipping those whose catalog
+     * is already there, and then sets the directory so that the surveys that
+     * follow replay the catalogs instead of searching. The factory is
+     * consumed and deleted.
+     *
+     * The surveys over MPI only read catalogs; they should be exported
+     * beforehand, for example by @c bin/catalog, rather than by every rank.
+     *
+     * @param[in] inputs The inputs whose catalogs to export.
+     * @param[in] directory The directory of catalogs.
+     *
+     * @see Gauge::NVectorCatalog::SetDirectory
+     * @see Gauge::NVectorHandler::Export
+     */
+    void Catalog(
+        Gauge::InputFactory::Generic *inputs,
+        std::string directory
+      );
+
+    /*!
+     * This function runs a survey over MPI without shipping any geometries.
+     * Every builder runs its own Gauge::GeometryFactory and pulls contiguous
+     * ranges of ordinals, sized to its measured build time, off a counter
+     * held by the root in one-sided memory, while the root only merges the
+     * processors of the builders. The models built are exactly those of
+     * Gauge::Survey::Parallel.
+     *
+     * @see Gauge::GeometryFactory::Position
+     */
+    void Decentralized(
         int &argc, char **argv,
         Gauge::ProcessorList &&processors,
         Gauge::GeometryFactory *geometry_factory,
@@ -38,11 +69,72 @@ namespace Gauge {
         std::string log_file
       );
 
+    /*!
+     * This function runs a survey over MPI in which every builder process
+     * runs a pool of threads. The root deals out Gauge::WorkUnit ranges of
+     * ordinals as in Gauge::Survey::Parallel; each builder rebuilds their
+     * geometries on its calling thread and hands them to its threads through
+     * a rank-local Utility::Queue, as in Gauge::Survey::Threaded. The local
+     * processors of the threads are merged within the process before they
+     * are sent to the root.
+     *
+     * @param[in] threads The number of threads of each builder, or @c 0 for
+     * one per hardware thread.
+     * @param[in] window The number of units sent ahead to each builder.
+     */
+    void Hybrid(
+        int &argc, char **argv,
+        Gauge::ProcessorList &&processors,
+        Gauge::GeometryFactory *geometry_factory,
+        Gauge::InputFactory::Generic *inputs,
+        std::string log_file,
+        int threads = 0,
+        int window = 2
+      );
+
+    /*!
+     * This function runs a survey over MPI in which the root deals out the
+     * geometries and the other processes build them. The builders pull
+     * Gauge::WorkUnit ranges of ordinals from the root as they finish the
+     * ones they have, each sized to the measured build time, and rebuild the
+     * geometries of a unit with their own Gauge::GeometryFactory. The units
+     * of a builder are cut from a contiguous run of ordinals of its own,
+     * until it takes over part of the run of another.
+     *
+     * @param[in] window The number of units sent ahead to each builder.
+     */
+    void Parallel(
+        int &argc, char **argv,
+        Gauge::ProcessorList &&processors,
+        Gauge::GeometryFactory *geometry_factory,
+        Gauge::InputFactory::Generic *inputs,
+        std::string log_file,
+        int window = 2
+      );
+
     void Serial(
         Gauge::ProcessorList &&processors,
         Gauge::GeometryFactory *geometry_factory,
         Gauge::InputFactory::Generic *inputs,
         std::string log_file
       );
+
+    /*!
+     * This function runs a survey on the threads of a single process. The
+     * calling thread produces batches of geometries sharing a Gauge::Basis
+     * and hands them to the builders through a bounded Utility::Queue. Each
+     * builder has its own Gauge::ModelFactory and local copy of the
+     * processors, which are merged into @c processors at the end.
+     *
+     * @param[in] threads The number of builders, or @c 0 for one per
+     * hardware thread.
+     */
+    void Threaded(
+        Gauge::ProcessorList &&processors,
+        Gauge::GeometryFactory *geometry_factory,
+        Gauge::InputFactory::Generic *inputs,
+        std::string log_file,
+        int threads = 0
+      );
   }
 }
@@ -1,3 +1,4 @@
 #pragma once
 
 #include <Utility/Directory.h>
+#include <Utility/Queue.h>
@@ -0,0 +1,136 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file include/Utility/Queue.h
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief Utility::Queue is a bounded queue that any number of threads may push
+ * to and pop from without locking.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+
+namespace Utility {
+  /*!
+   * @brief
+   * Utility::Queue is a fixed-size ring of cells, each carrying a sequence
+   * number that tells a pushing or popping thread whether the cell is ready
+   * for it. A thread claims a cell by advancing the tail or the head with a
+   * compare and swap, so neither end ever blocks; a full or empty queue is
+   * reported to the caller instead.
+   */
+  template <class T>
+  class Queue {
+    public:
+      /*!
+       * The constructor allocates the ring.
+       *
+       * @param[in] capacity The number of items the queue holds, which must
+       * be a power of two.
+       */
+      explicit Queue(size_t capacity) : mask_(capacity - 1) {
+        assert(capacity >= 2 && (capacity & mask_) == 0);
+        cells_ = new Cell[capacity];
+        for (size_t index = 0; index < capacity; ++index)
+          cells_[index].sequence.store(index, std::memory_order_relaxed);
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+      }
+      /*!
+       * The destructor deallocates the ring. Items still in the queue are
+       * not released.
+       */
+      ~Queue() { delete [] cells_; }
+      /*!
+       * This method appends an item to the queue.
+       *
+       * @param[in] item The item to append.
+       *
+       * @return @c false if the queue is full.
+       */
+      bool Push(const T &item) {
+        Cell *cell;
+        size_t position = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+          cell = &cells_[position & mask_];
+          size_t sequence = cell->sequence.load(std::memory_order_acquire);
+          ptrdiff_t difference = sequence - position;
+          if (difference == 0) {
+            if (tail_.compare_exchange_weak(position, position + 1,
+                                            std::memory_order_relaxed))
+              break;
+          } else if (difference < 0) {
+            return false;
+          } else {
+            position = tail_.load(std::memory_order_relaxed);
+          }
+        }
+        cell->item = item;
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+      /*!
+       * This method removes the oldest item from the queue.
+       *
+       * @param[out] item The item removed.
+       *
+       * @return @c false if the queue is empty.
+       */
+      bool Pop(T *item) {
+        Cell *cell;
+        size_t position = head_.load(std::memory_order_relaxed);
+        for (;;) {
+          cell = &cells_[position & mask_];
+          size_t sequence = cell->sequence.load(std::memory_order_acquire);
+          ptrdiff_t difference = sequence - (position + 1);
+          if (difference == 0) {
+            if (head_.compare_exchange_weak(position, position + 1,
+                                            std::memory_order_relaxed))
+              break;
+          } else if (difference < 0) {
+            return false;
+          } else {
+            position = head_.load(std::memory_order_relaxed);
+          }
+        }
+        *item = cell->item;
+        cell->sequence.store(position + mask_ + 1, std::memory_order_release);
+        return true;
+      }
+
+    private:
+      struct Cell {
+        std::atomic<size_t> sequence; /*!< The position the cell is ready
+                                        for; one past it once filled. */
+        T item;                       /*!< The item held. */
+      };
+
+      Queue(const Queue &other) {}
+      Queue &operator=(const Queue &other) { return *this; }
+
+      Cell *cells_;                   /*!< The ring of cells. */
+      std::atomic<size_t> head_;      /*!< The position of the next pop. */
+      size_t mask_;                   /*!< One less than the capacity. */
+      std::atomic<size_t> tail_;      /*!< The position of the next push. */
+  };
+}
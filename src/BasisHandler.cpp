@@ -31,6 +31,8 @@
 // System Headers
 #include <cassert>
 
+#include <algorithm>
+
 // Framework Headers
 #include <BasisHandler.h>
 
@@ -45,33 +47,151 @@
  */
 void Gauge::BasisHandler::Setup(const Gauge::Input &input) {
   nvector_handler_.Setup(input.orders, input.layers, 26 - input.dimensions);
-  basis_ = Basis(input.layers, 26 - input.dimensions);
+  if (SetupBasis(input)) {
+    next_ = 0;
+    last_ = catalog_.count();
+  }
+}
+
+/*!
+ * This is identical to the plain Setup, except that the
+ * Gauge::BasisHandler::nvector_handler_ is restricted to the provided slice.
+ *
+ * @see Gauge::NVectorHandler::Setup(const Gauge::NVectorSlice&)
+ */
+void Gauge::BasisHandler::Setup(const Gauge::Input &input,
+    const Gauge::NVectorSlice &slice) {
+  assert(slice.size == 26 - input.dimensions && slice.layers == input.layers);
+  if (SetupBasis(input)) {
+    nvector_handler_.Setup(input.orders, input.layers, 26 - input.dimensions);
+    next_ = catalog_.First(slice.begin) + slice.position;
+    last_ = catalog_.First(slice.end);
+    if (next_ > last_) next_ = last_;
+  } else {
+    nvector_handler_.Setup(slice);
+  }
+}
+
+/*!
+ * The catalog, when it is found, must have been written for the same orders
+ * and size; otherwise the handler falls back to the search.
+ */
+bool Gauge::BasisHandler::SetupBasis(const Gauge::Input &input) {
+  int size = 26 - input.dimensions;
+  basis_ = Basis(input.layers, size);
   for (int index = 0; index < input.layers; ++index) {
     basis_.base[index].order = input.orders[index];
   }
+  filled_ = false;
+  next_ = 0;
+  last_ = 0;
+  ordinal_ = 0;
+  starts_.clear();
+  return catalog_.Open(Gauge::NVectorCatalog::Path(input.orders, input.layers,
+        size), input.orders, input.layers, size);
 }
 
 /*!
- * All Gauge::BasisHandler::NextBasis does is make a call to
+ * When replaying a catalog, we simply fill the basis from its next record,
+ * starting from the first value that differs from the record before it.
+ * Otherwise, all Gauge::BasisHandler::NextBasis does is make a call to
  * Gauge::NVectorHandler::NextSolution and, if that method returns true
  * indicating a new Gauge::NVector has been found, it calls
- * Gauge::BasisHandler::FillBasis.
+ * Gauge::BasisHandler::FillBasis with the first column the
+ * Gauge::NVectorHandler reports as changed.
  *
  * @see Gauge::NVectorHandler::NextSolution
+ * @see Gauge::NVectorHandler::changed
  * @see Gauge::BasisHandler::FillBasis
  */
 bool Gauge::BasisHandler::NextBasis() {
+  int column = 0;
+  if (catalog_.IsOpen()) {
+    if (next_ == last_) return false;
+    const unsigned char *record = catalog_.Record(next_);
+    if (filled_) {
+      const unsigned char *previous = catalog_.Record(next_ - 1);
+      while (column < nvector_handler_.avalue() &&
+          record[column] == previous[column]) ++column;
+    }
+    FillBasis(record, column);
+    ++next_;
+    return true;
+  }
   if (nvector_handler_.NextSolution()) {
-    FillBasis();
+    if (filled_) column = nvector_handler_.changed();
+    FillBasis(nvector_handler_.CurrentSolution()->base, column);
+    ++ordinal_;
     return true;
   }
   return false;
 }
 
+/*!
+ * The counts of the layer @c 0 solutions are kept as running sums, so that
+ * Gauge::BasisHandler::Seek can find the solution a basis descends from.
+ */
+uint64_t Gauge::BasisHandler::Count() {
+  if (catalog_.IsOpen()) return catalog_.count();
+  if (starts_.empty()) {
+    std::vector<uint64_t> weights;
+    nvector_handler_.Count(&weights);
+    starts_.resize(weights.size() + 1, 0);
+    for (size_t index = 0; index < weights.size(); ++index) {
+      starts_[index + 1] = starts_[index] + weights[index];
+    }
+  }
+  return starts_.back();
+}
+
+/*!
+ * A catalog is simply moved to the record. Otherwise, when the basis descends
+ * from the same layer @c 0 solution as the next one, the Gauge::NVectors
+ * between them are stepped over; when it does not, the
+ * Gauge::NVectorHandler is set up on the Gauge::NVectorSlice beginning at its
+ * layer @c 0 solution, so that only the Gauge::NVectors of that solution are
+ * skipped by their counts. Either way the skipped bases are never filled, so the next one is
+ * filled from scratch.
+ *
+ * @see Gauge::NVectorHandler::Setup(const Gauge::NVectorSlice&)
+ */
+void Gauge::BasisHandler::Seek(uint64_t ordinal) {
+  assert(ordinal >= Position());
+  if (ordinal == Position()) return;
+  filled_ = false;
+  if (catalog_.IsOpen()) {
+    next_ = std::min(ordinal, last_);
+    return;
+  }
+  uint64_t count = Count();
+  ordinal = std::min(ordinal, count);
+  uint64_t root = std::upper_bound(starts_.begin(), starts_.end(), ordinal) -
+    starts_.begin() - 1;
+  uint64_t current = std::upper_bound(starts_.begin(), starts_.end(),
+      ordinal_) - starts_.begin() - 1;
+  if (ordinal < count && root == current) {
+    while (ordinal_ < ordinal && nvector_handler_.NextSolution()) ++ordinal_;
+    return;
+  }
+  Gauge::NVectorSlice slice = nvector_handler_.Slice();
+  slice.begin = root;
+  slice.position = ordinal - starts_[root];
+  if (ordinal == count) slice.end = root;
+  nvector_handler_.Setup(slice);
+  ordinal_ = ordinal;
+}
+
 /*!
  * This method uses the a-value, and a-matrix computed by Gauge::NVectorHandler,
  * as well as the current Gauge::NVector to fill in the basis.
  *
+ * Only the entries from the first changed column onwards can move, and only in
+ * the vectors whose row of the a-matrix is nonzero somewhere past it; in the
+ * others those entries are all zero. So those vectors are rewritten from that
+ * column on, clearing whatever their previous values left behind, and the rest
+ * only have their trailing index updated. The vectors are ordered by layer, so
+ * the unchanged ones are a prefix.
+ *
  * @see Gauge::NVectorHandler::avalue
  * @see Gauge::NVectorHandler::amatrix
  * @see Gauge::Basis::Size
@@ -79,28 +199,39 @@ bool Gauge::BasisHandler::NextBasis() {
  * @see Gauge::Basis::At
  * @see Gauge::BasisVector::Set
  */
-void Gauge::BasisHandler::FillBasis() {
+template <class T>
+void Gauge::BasisHandler::FillBasis(const T *values, int column) {
   const int& avalue = nvector_handler_.avalue();
   const int& layer  = basis_.size;
-  const int** amatrix = nvector_handler_.amatrix();
-
-  const Gauge::NVector* nvector = nvector_handler_.CurrentSolution();
+  const int *const *amatrix = nvector_handler_.amatrix();
 
+  unchanged_ = layer;
   for (int vector = 0; vector < layer; ++vector) {
+    Gauge::BasisVector &basis_vector = basis_.base[vector];
+    int n = column;
+    while (n < avalue && amatrix[vector][n] == 0) ++n;
+    bool affected = (column == 0 || n < avalue);
+    if (affected && unchanged_ == layer) unchanged_ = vector;
+
     int index = 0;
     bool found = false;
-    for (int n = 0; n < avalue; ++n) {
+    for (n = 0; n < avalue; ++n) {
       if (!found && amatrix[vector][n] != 0) {
-        basis_.base[vector].leading = index;
+        basis_vector.leading = index;
         found = true;
       }
-      for (int i = 0; i < nvector->base[n]; ++i, ++index) {
-        basis_.base[vector].base[index] = 2*amatrix[vector][n];
+      if (!affected || n < column) {
+        index += values[n];
+        continue;
+      }
+      for (int i = 0; i < values[n]; ++i, ++index) {
+        basis_vector.base[index] = 2*amatrix[vector][n];
       }
     }
-    basis_.base[vector].trailing = index;
-    for (; index < basis_.base[vector].size; ++index) {
-      basis_.base[vector].base[index] = 0;
-    }
+    int stop = (column == 0) ? basis_vector.size : basis_vector.trailing;
+    basis_vector.trailing = index;
+    if (!affected) continue;
+    for (; index < stop; ++index) basis_vector.base[index] = 0;
   }
+  filled_ = true;
 }
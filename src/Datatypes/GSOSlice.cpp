@@ -0,0 +1,46 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file Datatypes/GSOSlice.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief The implementation of the Gauge::GSOSlice datatype, a descriptor of a
+ * disjoint piece of the Gauge::GSOHandler enumeration.
+ */
+
+#include <Datatypes/GSOSlice.h>
+
+// Printable Interface
+void Gauge::GSOSlice::PrintTo(std::ostream *out) const {
+  *out << "[" << begin << ", " << end << ") @" << position;
+}
+
+// Serializable Interface
+void Gauge::GSOSlice::SerializeWith(Gauge::Serializer *serializer) const {
+  // The ranks can be very large, so we cannot compress them.
+  serializer->Write<uint64_t>(begin);
+  serializer->Write<uint64_t>(end);
+  serializer->Write<uint64_t>(position);
+}
+
+void Gauge::GSOSlice::DeserializeWith(Gauge::Serializer *serializer) {
+  serializer->Read<uint64_t>(&begin);
+  serializer->Read<uint64_t>(&end);
+  serializer->Read<uint64_t>(&position);
+}
@@ -0,0 +1,118 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file Datatypes/NVectorSlice.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief The implementation of the Gauge::NVectorSlice datatype, a descriptor
+ * of a disjoint piece of the Gauge::NVectorHandler search.
+ */
+
+// C Headers
+#include <cstdlib>
+
+// Gauge Framework Headers
+#include <Datatypes/NVectorSlice.h>
+
+Gauge::NVectorSlice::NVectorSlice(const int *orders, int layers, int size,
+    uint64_t begin, uint64_t end) : layers(layers), size(size), begin(begin),
+    end(end), position(0) {
+  this->orders = new int[this->layers];
+  for (int index = 0; index < this->layers; ++index) {
+    this->orders[index] = orders[index];
+  }
+}
+
+Gauge::NVectorSlice::NVectorSlice(const Gauge::NVectorSlice &other) {
+  layers = other.layers;
+  orders = new int[layers];
+  for (int index = 0; index < layers; ++index) orders[index] = other.orders[index];
+  size = other.size;
+  begin = other.begin;
+  end = other.end;
+  position = other.position;
+}
+
+/*!
+ * The assignment operator checks that we aren't reassigning to the same
+ * instance and then copies as the copy constructor does.
+ */
+Gauge::NVectorSlice& Gauge::NVectorSlice::operator=(
+    const Gauge::NVectorSlice &other) {
+  if (this != &other) {
+    if (orders != NULL && layers != other.layers) {
+      delete [] orders;
+      orders = NULL;
+    }
+    if (orders == NULL) orders = new int[other.layers];
+    layers = other.layers;
+    for (int index = 0; index < layers; ++index)
+      orders[index] = other.orders[index];
+    size = other.size;
+    begin = other.begin;
+    end = other.end;
+    position = other.position;
+  }
+  return *this;
+}
+
+bool Gauge::NVectorSlice::operator==(const Gauge::NVectorSlice &other) const {
+  if (layers != other.layers || size != other.size) return false;
+  if (begin != other.begin || end != other.end) return false;
+  if (position != other.position) return false;
+  for (int index = 0; index < layers; ++index)
+    if (orders[index] != other.orders[index]) return false;
+  return true;
+}
+
+// Printable Interface
+void Gauge::NVectorSlice::PrintTo(std::ostream *out) const {
+  *out << "[ ";
+  for (int index = 0; index < layers; ++index) *out << orders[index] << " ";
+  *out << "] size=" << size << " [" << begin << ", " << end << ") @"
+    << position;
+}
+
+// Serializable Interface
+void Gauge::NVectorSlice::SerializeWith(Gauge::Serializer *serializer) const {
+  // Since we are only considering layers up to about 20, we can compress to a
+  // char.
+  serializer->Write<char>(layers);
+  // Our orders are below 100, so we can compress to char.
+  serializer->Write<char>(orders, orders + layers);
+  // Our sizes do not exceed 22, so we can compress to char.
+  serializer->Write<char>(size);
+  // The ordinals and position can be very large, so we cannot compress them.
+  serializer->Write<uint64_t>(begin);
+  serializer->Write<uint64_t>(end);
+  serializer->Write<uint64_t>(position);
+}
+
+void Gauge::NVectorSlice::DeserializeWith(Gauge::Serializer *serializer) {
+  serializer->Read<char>(&layers);
+
+  if (orders != NULL) delete [] orders;
+  orders = new int[layers];
+
+  serializer->Read<char>(orders, orders + layers);
+  serializer->Read<char>(&size);
+  serializer->Read<uint64_t>(&begin);
+  serializer->Read<uint64_t>(&end);
+  serializer->Read<uint64_t>(&position);
+}
@@ -0,0 +1,43 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file Datatypes/WorkUnit.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief The implementation of the Gauge::WorkUnit datatype, a descriptor of a
+ * run of the geometries of a Gauge::GeometryFactory.
+ */
+
+#include <Datatypes/WorkUnit.h>
+
+// Printable Interface
+void Gauge::WorkUnit::PrintTo(std::ostream *out) const {
+  *out << "[" << begin << ", " << end << ")";
+}
+
+// Serializable Interface
+void Gauge::WorkUnit::SerializeWith(Gauge::Serializer *serializer) const {
+  serializer->Write<uint64_t>(begin);
+  serializer->Write<uint64_t>(end);
+}
+
+void Gauge::WorkUnit::DeserializeWith(Gauge::Serializer *serializer) {
+  serializer->Read<uint64_t>(&begin);
+  serializer->Read<uint64_t>(&end);
+}
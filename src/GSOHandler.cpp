@@ -29,15 +29,36 @@
  * Gauge::GSOMatrix instances.
  */
 
+// C++ Headers
+#include <algorithm>
+#include <map>
+
+// Gauge Framework Headers
 #include <GSOHandler.h>
 #include <Math.h>
 
-Gauge::GSOHandler::GSOHandler() {
+Gauge::GSOHandler::GSOHandler(bool permutations) {
+  begin_ = 0;
+  permutations_ = permutations;
+  choices_ = NULL;
+  counts_ = NULL;
+  empty_ = true;
+  end_ = 0;
   first_ = true;
+  fractions_ = NULL;
+  indices_ = NULL;
+  multiplicity_ = 1;
+  offsets_ = NULL;
+  ones_ = NULL;
   orders_ = NULL;
+  phases_ = NULL;
   products_ = NULL;
+  rank_ = 0;
   setup_ = false;
+  start_ = 0;
   susy_type_ = Gauge::Input::kSUSY;
+  total_ = 0;
+  weights_ = NULL;
   extra_layers_ = 2;
 }
 
@@ -46,34 +67,177 @@ Gauge::GSOHandler::~GSOHandler() {
   ClearProducts();
 }
 
+/*!
+ * Consecutive bases of a Gauge::BasisHandler share their shape, so when the
+ * size and the number of extra layers match the previous call, the working
+ * Gauge::GSOMatrix and the orders and products are reused, and only the
+ * products and admissible choices involving the changed basis vectors are
+ * recomputed.
+ */
 void Gauge::GSOHandler::Setup(const Gauge::Basis &basis,
-                              Gauge::Input::SUSYType susy_type) {
-  ClearOrders();
-  ClearProducts();
-
+                              Gauge::Input::SUSYType susy_type,
+                              int unchanged) {
+  int extra_layers = (susy_type != Gauge::Input::kNonSUSY) ? 2 : 1;
+  int size = basis.size + extra_layers;
   susy_type_ = susy_type;
 
-  extra_layers_ = (susy_type != Gauge::Input::kNonSUSY) ? 2 : 1;
-  kij_ = Gauge::GSOMatrix(basis.size + extra_layers_);
-  orders_ = new int[basis.size + extra_layers_];
-  products_ = new Gauge::Math::Rational*[basis.size + extra_layers_];
-  for (int row = 0; row < basis.size + extra_layers_; ++row) {
-    if (row < extra_layers_) {
-      orders_[row] = 2;
-    } else {
-      orders_[row] = basis.base[row - extra_layers_].order;
+  if (!setup_ || extra_layers != extra_layers_ || kij_.size != size) {
+    ClearOrders();
+    ClearProducts();
+
+    extra_layers_ = extra_layers;
+    kij_ = Gauge::GSOMatrix(size);
+    orders_ = new int[size];
+    offsets_ = new int[size + 1];
+    ones_ = new int[size];
+    fractions_ = new Gauge::Math::Rational*[size];
+    choices_ = new Choice*[size];
+    counts_ = new int*[size];
+    indices_ = new int*[size];
+    phases_ = new int*[size];
+    products_ = new int*[size];
+    weights_ = new uint64_t*[size];
+    for (int row = 0; row < size; ++row) {
+      orders_[row] = 0;
+      fractions_[row] = NULL;
+      choices_[row] = NULL;
+      counts_[row] = new int[row+1];
+      indices_[row] = new int[row+1];
+      phases_[row] = new int[size];
+      products_[row] = new int[row+1];
+      weights_[row] = new uint64_t[row+1];
     }
-    products_[row] = new Gauge::Math::Rational[row+1];
+    unchanged = 0;
+  }
+  bool reordered = false;
+  for (int row = 0; row < size; ++row) {
+    int order = (row < extra_layers_) ? 2 :
+      basis.base[row - extra_layers_].order;
+    if (order != orders_[row]) {
+      SetupFractions(row, order);
+      reordered = true;
+    }
+  }
+  if (reordered) {
+    // The choices of every row are laid out by the orders of the columns.
+    offsets_[0] = 0;
+    for (int column = 0; column < size; ++column) {
+      offsets_[column + 1] = offsets_[column] + orders_[column];
+    }
+    for (int row = 0; row < size; ++row) {
+      if (choices_[row] != NULL) delete [] choices_[row];
+      choices_[row] = new Choice[offsets_[row]];
+    }
+    unchanged = 0;
   }
 
-  ComputeProducts(basis);
+  ComputeProducts(basis, unchanged);
+  ComputeChoices(unchanged);
+  automorphisms_.clear();
+  signs_.clear();
+  if (permutations_) ComputeAutomorphisms(basis);
+  begin_ = 0;
+  end_ = total_;
+  start_ = 0;
   first_ = true;
   setup_ = true;
 }
 
+/*!
+ * The current Gauge::GSOMatrix is only produced if its rank is still within
+ * the Gauge::GSOSlice being enumerated; otherwise the enumeration is over.
+ */
 bool Gauge::GSOHandler::NextGSOMatrix() {
   assert(setup_);
-  return (first_ && FirstGSOMatrix()) || Next();
+  if (empty_) return false;
+  bool found;
+  if (first_) {
+    found = start_ < end_ && FirstGSOMatrix();
+  } else {
+    found = rank_ < end_ && Next();
+  }
+  while (found && rank_ < end_ && !Representative()) found = Next();
+  if (found && rank_ < end_) return true;
+  first_ = false;
+  rank_ = end_;
+  return false;
+}
+
+void Gauge::GSOHandler::Seek(const Gauge::GSOSlice &slice) {
+  assert(setup_);
+  begin_ = std::min(slice.begin, total_);
+  end_ = std::min(slice.end, total_);
+  start_ = std::min(slice.begin + slice.position, end_);
+  first_ = true;
+}
+
+/*!
+ * The ranks are shared out as evenly as possible; the first
+ * @f$ total \bmod parts @f$ slices own one more than the rest.
+ */
+void Gauge::GSOHandler::Split(int parts, Gauge::GSOSlice *slices) const {
+  assert(setup_ && parts > 0);
+  uint64_t share = total_ / parts, extra = total_ % parts;
+  uint64_t begin = 0;
+  for (int part = 0; part < parts; ++part) {
+    uint64_t end = begin + share + (static_cast<uint64_t>(part) < extra);
+    slices[part] = Gauge::GSOSlice(begin, end);
+    begin = end;
+  }
+}
+
+Gauge::GSOSlice Gauge::GSOHandler::Slice() const {
+  Gauge::GSOSlice slice(begin_, end_);
+  uint64_t next = first_ ? start_ : std::min(rank_ + 1, end_);
+  slice.position = next - begin_;
+  return slice;
+}
+
+/*!
+ * Every combination of choices of the elements that are enumerated is produced
+ * once, so their number is the product of the counts. For reduced SUSY, the
+ * combinations in which no element of the second column is @c 1 are then
+ * taken away.
+ */
+uint64_t Gauge::GSOHandler::Count() const {
+  assert(setup_);
+  if (empty_) return 0;
+  uint64_t invalid = 1;
+  for (int row = 2; row < kij_.size; ++row) {
+    for (int column = 1; column < row; ++column) {
+      if (column > 1) {
+        invalid *= counts_[row][column];
+      } else {
+        invalid *= counts_[row][column] - (ones_[row] != -1 ? 1 : 0);
+      }
+    }
+  }
+  if (susy_type_ != Gauge::Input::kReducedSUSY) return total_;
+  return total_ - invalid;
+}
+
+/*!
+ * An element of row @f$ i @f$ and column @f$ j @f$ is admitted when
+ * @f$ N_i k_{ij} @f$ is fixed modulo @c 1 by the products, and of the
+ * @f$ N_j @f$ phases at most @f$ \gcd(N_i, N_j) @f$ satisfy that. Full SUSY
+ * admits only one phase in the second column.
+ */
+uint64_t Gauge::GSOHandler::MaximumRanks(const Gauge::Input &input) {
+  int extra_layers = (input.susy_type != Gauge::Input::kNonSUSY) ? 2 : 1;
+  int size = input.layers + extra_layers;
+  uint64_t ranks = 1;
+  for (int row = 2; row < size; ++row) {
+    int order = (row < extra_layers) ? 2 : input.orders[row - extra_layers];
+    for (int column = 1; column < row; ++column) {
+      int other = (column < extra_layers) ? 2 :
+        input.orders[column - extra_layers];
+      uint64_t count = Gauge::Math::GCD(order, other);
+      if (column == 1 && input.susy_type == Gauge::Input::kFullSUSY) count = 1;
+      if (ranks > UINT64_MAX / count) return 0;
+      ranks *= count;
+    }
+  }
+  return ranks;
 }
 
 bool Gauge::GSOHandler::Project(const Gauge::Geometry &geometry,
@@ -111,11 +275,155 @@ bool Gauge::GSOHandler::Project(const Gauge::Geometry &geometry,
   return true;
 }
 
+/*!
+ * The phase a row of the Gauge::GSOMatrix contributes,
+ * \f$T = \sum_j c_j k_{rj}\f$, does not depend on the state, so it is
+ * computed once per row. A state with product \f$P/(d N)\f$ against the
+ * basis vector of order \f$N\f$ then survives when \f$P/(d N) - T\f$ is an
+ * even integer, that is when \f$P T_d - T_n d N\f$ vanishes modulo
+ * \f$2 d N T_d\f$. With three layers of orders up to 26 the modulus alone
+ * can pass \f$2^{31}\f$, so the congruence is tested in 64-bit integers.
+ * Each row is one pass of integer dot products over all the
+ * states, with no branches beyond clearing the survivors.
+ */
+void Gauge::GSOHandler::Project(const Gauge::Geometry &geometry,
+                                const int *states, int count, int den,
+                                const int *coefficients, char *survivors) {
+  using namespace Gauge::Math;
+  const Gauge::Basis &basis = geometry.basis;
+  const Gauge::GSOMatrix &gso = geometry.gso_matrix;
+  int extra_layers = gso.size - basis.size;
+  int width = basis.base[0].size;
+
+  for (int state = 0; state < count; ++state) survivors[state] = 1;
+
+  int *vector = new int[width];
+  for (int row = 0; row < gso.size; ++row) {
+    Rational phase = ProjectionPhase(gso, row, coefficients);
+    int order = ProjectionVector(basis, extra_layers, row, vector);
+
+    int64_t modulus = INT64_C(2) * den * order * phase.den;
+    int64_t offset = (static_cast<int64_t>(phase.num) * den * order) % modulus;
+    const int *values = states;
+    for (int state = 0; state < count; ++state, values += width) {
+      int product = 0;
+      for (int k = 0; k < width; ++k) product += values[k] * vector[k];
+      survivors[state] &=
+        ((static_cast<int64_t>(product) * phase.den - offset) % modulus == 0);
+    }
+  }
+  delete [] vector;
+}
+
+/*!
+ * Only the phases of the rows depend on the Gauge::GSOMatrix, so the product
+ * of each state with each basis vector is computed once for the whole batch.
+ * The states of a sector take few distinct products, and the bits of the
+ * Gauge::GSOMatrix instances that pass with a product are cached for each
+ * row, so most states cost one lookup and one AND per row.
+ */
+void Gauge::GSOHandler::Project(const Gauge::Basis &basis,
+                                const Gauge::GSOMatrix *matrices,
+                                int matrix_count, const int *states,
+                                int count, int den, const int *coefficients,
+                                uint64_t *survivors) {
+  using namespace Gauge::Math;
+  assert(0 < matrix_count && matrix_count <= 64);
+  int size = matrices[0].size;
+  int extra_layers = size - basis.size;
+  int width = basis.base[0].size;
+
+  uint64_t all = (matrix_count == 64) ? ~0ULL : (1ULL << matrix_count) - 1;
+  for (int state = 0; state < count; ++state) survivors[state] = all;
+
+  int *vector = new int[width];
+  Rational *phases = new Rational[matrix_count];
+  for (int row = 0; row < size; ++row) {
+    for (int matrix = 0; matrix < matrix_count; ++matrix) {
+      assert(matrices[matrix].size == size);
+      phases[matrix] = ProjectionPhase(matrices[matrix], row, coefficients);
+    }
+    int order = ProjectionVector(basis, extra_layers, row, vector);
+
+    std::map<int, uint64_t> passes;
+    const int *values = states;
+    for (int state = 0; state < count; ++state, values += width) {
+      int product = 0;
+      for (int k = 0; k < width; ++k) product += values[k] * vector[k];
+      std::map<int, uint64_t>::iterator pass = passes.find(product);
+      if (pass == passes.end()) {
+        uint64_t bits = 0;
+        for (int matrix = 0; matrix < matrix_count; ++matrix) {
+          const Rational &phase = phases[matrix];
+          int64_t modulus = INT64_C(2) * den * order * phase.den;
+          if ((static_cast<int64_t>(product) * phase.den -
+               static_cast<int64_t>(phase.num) * den * order) % modulus == 0) {
+            bits |= 1ULL << matrix;
+          }
+        }
+        pass = passes.insert(std::make_pair(product, bits)).first;
+      }
+      survivors[state] &= pass->second;
+    }
+  }
+  delete [] phases;
+  delete [] vector;
+}
+
+Gauge::Math::Rational Gauge::GSOHandler::ProjectionPhase(
+    const Gauge::GSOMatrix &gso, int row, const int *coefficients) {
+  using namespace Gauge::Math;
+  Rational phase(0);
+  for (int column = 0; column < gso.size; ++column) {
+    if (coefficients[column] == 0) continue;
+    Reduce(Add(&phase, Multiply(gso.base[row][column],
+                                Rational(coefficients[column]))));
+  }
+  return phase;
+}
+
+/*!
+ * The all periodic and SUSY basis vectors are not in the basis, so they are
+ * filled in here.
+ */
+int Gauge::GSOHandler::ProjectionVector(const Gauge::Basis &basis,
+                                        int extra_layers, int row,
+                                        int *vector) {
+  int width = basis.base[0].size;
+  if (row == 0) {
+    for (int k = 0; k < width; ++k) {
+      vector[k] = Gauge::kPeriodicBasisVector.base[k];
+    }
+    return Gauge::kPeriodicBasisVector.order;
+  } else if (row < extra_layers) {
+    for (int k = 0; k < width; ++k) vector[k] = 0;
+    return 1;
+  }
+  const Gauge::BasisVector &base = basis.base[row - extra_layers];
+  for (int k = 0; k < width; ++k) vector[k] = base.base[k];
+  return base.order;
+}
+
 void Gauge::GSOHandler::ClearOrders() {
   if (orders_ != NULL) {
     delete [] orders_;
     orders_ = NULL;
   }
+  if (fractions_ != NULL) {
+    for (int i = 0; i < kij_.size; ++i) {
+      if (fractions_[i] != NULL) delete [] fractions_[i];
+    }
+    delete [] fractions_;
+    fractions_ = NULL;
+  }
+  if (offsets_ != NULL) {
+    delete [] offsets_;
+    offsets_ = NULL;
+  }
+  if (ones_ != NULL) {
+    delete [] ones_;
+    ones_ = NULL;
+  }
 }
 
 void Gauge::GSOHandler::ClearProducts() {
@@ -129,128 +437,263 @@ void Gauge::GSOHandler::ClearProducts() {
     delete [] products_;
     products_ = NULL;
   }
+  if (phases_ != NULL) {
+    for (int i = 0; i < kij_.size; ++i) {
+      if (phases_[i] != NULL) delete [] phases_[i];
+    }
+    delete [] phases_;
+    phases_ = NULL;
+  }
+  if (choices_ != NULL) {
+    for (int i = 0; i < kij_.size; ++i) {
+      if (choices_[i] != NULL) delete [] choices_[i];
+      delete [] counts_[i];
+      delete [] indices_[i];
+    }
+    delete [] choices_;
+    delete [] counts_;
+    delete [] indices_;
+    choices_ = NULL;
+    counts_ = NULL;
+    indices_ = NULL;
+  }
+  if (weights_ != NULL) {
+    for (int i = 0; i < kij_.size; ++i) delete [] weights_[i];
+    delete [] weights_;
+    weights_ = NULL;
+  }
+}
+
+/*!
+ * The fractions are reduced here, once per order, so that setting an element
+ * of the Gauge::GSOMatrix never needs a GCD.
+ */
+void Gauge::GSOHandler::SetupFractions(int row, int order) {
+  if (fractions_[row] != NULL) delete [] fractions_[row];
+  orders_[row] = order;
+  fractions_[row] = new Gauge::Math::Rational[order];
+  for (int phase = Lowest(order); phase <= order / 2; ++phase) {
+    fractions_[row][phase - Lowest(order)] =
+      Gauge::Math::Reduce(Gauge::Math::Rational(2 * phase, order));
+  }
 }
 
-void Gauge::GSOHandler::ComputeProducts(const Gauge::Basis &basis) {
-  for (int row = 0; row < basis.size + extra_layers_; ++row) {
+void Gauge::GSOHandler::ComputeProducts(const Gauge::Basis &basis,
+                                        int unchanged) {
+  int first = (unchanged > 0) ? extra_layers_ + unchanged : 0;
+  for (int row = first; row < basis.size + extra_layers_; ++row) {
     for (int column = 0; column <= row; ++column) {
+      Gauge::Math::Rational product(0);
       if (column == 0) {
         if (row == 0) {
-          products_[row][column] =
-            Gauge::Math::Rational(basis.base[0].size);
+          product = Gauge::Math::Rational(basis.base[0].size);
         } else if (row >= extra_layers_) {
-          products_[row][column] =
-              Gauge::Math::Product(basis.base[row - extra_layers_],
-                                   Gauge::kPeriodicBasisVector);
-          Reduce(&products_[row][column]);
+          product = Gauge::Math::Product(basis.base[row - extra_layers_],
+                                         Gauge::kPeriodicBasisVector);
         }
       } else if (column >= extra_layers_) {
-          products_[row][column] =
-              Gauge::Math::Product(basis.base[row - extra_layers_],
-                                   basis.base[column - extra_layers_]);
-          Reduce(&products_[row][column]);
-      } else {
-        products_[row][column] = Gauge::Math::Rational(0);
+        product = Gauge::Math::Product(basis.base[row - extra_layers_],
+                                       basis.base[column - extra_layers_]);
       }
+      int scale = orders_[row] * orders_[column];
+      assert(scale % product.den == 0);
+      products_[row][column] = product.num * (scale / product.den);
     }
   }
 }
 
-bool Gauge::GSOHandler::FirstGSOMatrix() {
+/*!
+ * Everything modular invariance asks of an element is known once the products
+ * are, so each lower-triangle element gets the ordered list of its admissible
+ * phases, along with the upper-triangle and diagonal phases they fix.
+ */
+void Gauge::GSOHandler::ComputeChoices(int unchanged) {
+  int first = (unchanged > 0) ? extra_layers_ + unchanged : 0;
+  for (int row = first; row < kij_.size; ++row) {
+    for (int column = 0; column < row; ++column) {
+      Choice *choices = choices_[row] + offsets_[column];
+      int order = orders_[column];
+      int count = 0;
+      for (int element = Lowest(order); element <= order / 2; ++element) {
+        if (Admit(row, column, element, &choices[count])) ++count;
+      }
+      counts_[row][column] = count;
+    }
+    ones_[row] = -1;
+    if (row < 2 || susy_type_ != Gauge::Input::kReducedSUSY) continue;
+    for (int index = 0; index < counts_[row][1]; ++index) {
+      if (choices_[row][offsets_[1] + index].element == 1) ones_[row] = index;
+    }
+  }
+  // The weights of the digits of the odometer, from the least significant.
+  total_ = 1;
   for (int row = 0; row < kij_.size; ++row) {
     for (int column = 0; column < row; ++column) {
-      assert(MinimizeElement(row,column));
+      weights_[row][column] = (row >= 2 && column >= 1) ? total_ : 0;
+      if (row >= 2 && column >= 1) total_ *= counts_[row][column];
     }
   }
-  first_ = false;
-  return Validate();
-}
-
-bool Gauge::GSOHandler::MinimizeElement(int row, int column) {
-  int order = orders_[column];
-  Gauge::Math::Rational element(-2 * (order / 2 - 1 + (order & 1)),order);
-  Reduce(&element);
-  while (!SetElement(row, column, element)) {
-    Reduce(Add(&element, Gauge::Math::Rational(2,order)));
-    if (element > 1) return false;
+  empty_ = false;
+  for (int row = 0; row < kij_.size && !empty_; ++row) {
+    for (int column = 0; column < row && !empty_; ++column) {
+      empty_ = (counts_[row][column] == 0);
+    }
+  }
+  if (!empty_ && susy_type_ == Gauge::Input::kReducedSUSY) {
+    empty_ = true;
+    for (int row = 2; row < kij_.size && empty_; ++row) {
+      empty_ = (ones_[row] == -1);
+    }
   }
-  return true;
 }
 
-bool Gauge::GSOHandler::SetElement(int row, int column,
-                                   const Gauge::Math::Rational &element) {
+bool Gauge::GSOHandler::Admit(int row, int column, int element,
+                              Choice *choice) {
   if (column == 1 && susy_type_ == Gauge::Input::kFullSUSY) {
     if (element != 0) return false;
   }
-  Gauge::Math::Rational tnemele, diagonal;
-  if (!ComputeOffDiagonal(tnemele, row, column, element)) return false;
-  if (column == 0 && !ComputeDiagonal(diagonal, row, element)) return false;
-  kij_.base[row][column] = element;
-  kij_.base[column][row] = tnemele;
-  if (column == 0) kij_.base[row][row] = diagonal;
+  if (!ComputeOffDiagonal(choice->tnemele, row, column, element)) return false;
+  if (column == 0 && !ComputeDiagonal(choice->diagonal, row, element)) {
+    return false;
+  }
+  choice->element = element;
   return true;
 }
 
-bool Gauge::GSOHandler::ComputeOffDiagonal(Gauge::Math::Rational &tnemele,
-    int row, int column, const Gauge::Math::Rational &element) {
+/*!
+ * The elements are set to the digits of the rank to start from, the most
+ * significant first. If that Gauge::GSOMatrix is not valid, the enumeration
+ * moves on to the next one that is.
+ */
+bool Gauge::GSOHandler::FirstGSOMatrix() {
+  uint64_t rank = start_;
+  rank_ = 0;
+  for (int row = kij_.size - 1; row > 0; --row) {
+    for (int column = row - 1; column >= 0; --column) {
+      int index = 0;
+      if (weights_[row][column] != 0) {
+        index = rank / weights_[row][column];
+        rank %= weights_[row][column];
+      }
+      indices_[row][column] = 0;
+      SetElement(row, column, index);
+    }
+  }
+  first_ = false;
+  return Validate() || Next();
+}
 
-  tnemele = Divide(products_[row][column],2);
-  Reduce(Mod(Subtract(&tnemele, element), 2));
+/*!
+ * Only the phases are copied here; the elements of the Gauge::GSOMatrix are
+ * looked up in the table of reduced fractions.
+ */
+void Gauge::GSOHandler::SetElement(int row, int column, int index) {
+  const Choice &choice = choices_[row][offsets_[column] + index];
+  rank_ -= weights_[row][column] * indices_[row][column];
+  rank_ += weights_[row][column] * index;
+  indices_[row][column] = index;
+  phases_[row][column] = choice.element;
+  phases_[column][row] = choice.tnemele;
+  kij_.base[row][column] = Fraction(column, choice.element);
+  kij_.base[column][row] = Fraction(row, choice.tnemele);
+  if (column == 0) {
+    phases_[row][row] = choice.diagonal;
+    kij_.base[row][row] = Fraction(row, choice.diagonal);
+  }
+}
 
-  int lcm = abs(Gauge::Math::LCM(tnemele.den, orders_[row]));
-  if (lcm != orders_[row]) return false;
-  int common = lcm / tnemele.den;
-  Multiply(&tnemele, Gauge::Math::Rational(common, common));
-  if (tnemele.num & 1) return false;
-  Reduce(Cycle(&tnemele));
+/*!
+ * Modular invariance requires the upper-triangle element to be congruent to
+ * half the product less the lower-triangle element, modulo @c 2. In units of
+ * the phases, with the products scaled by the orders of their row and column,
+ * that is the requirement that
+ * \f$4 N_j k_{ji} = P_{ij} - 4 N_i k_{ij}\f$ have an integer solution, which
+ * is then cycled into the range of phases of the row.
+ */
+bool Gauge::GSOHandler::ComputeOffDiagonal(int &tnemele, int row, int column,
+                                           int element) {
+  int numerator = products_[row][column] - 4 * element * orders_[row];
+  int denominator = 4 * orders_[column];
+  if (numerator % denominator != 0) return false;
+  tnemele = CyclePhase(numerator / denominator, orders_[row]);
   return true;
 }
 
-bool Gauge::GSOHandler::ComputeDiagonal(Gauge::Math::Rational &diagonal,
-    int row, const Gauge::Math::Rational &element) {
-  diagonal = Divide(products_[row][row], 4);
-  Reduce(Mod(Subtract(&diagonal, element), 2));
-
-  int lcm = abs(Gauge::Math::LCM(diagonal.den, orders_[row]));
-  if (lcm != orders_[row]) return false;
-  int common = lcm / diagonal.den;
-  Multiply(&diagonal, Gauge::Math::Rational(common, common));
-  if (diagonal.num & 1) return false;
-  Reduce(Cycle(&diagonal));
+/*!
+ * As with the off-diagonal elements, but the diagonal is congruent to a
+ * quarter of the norm less the first-column element, which gives
+ * \f$8 N_i k_{ii} = P_{ii} - 4 N_i^2 k_{i0}\f$.
+ */
+bool Gauge::GSOHandler::ComputeDiagonal(int &diagonal, int row, int element) {
+  int numerator = products_[row][row] -
+    4 * element * orders_[row] * orders_[row];
+  int denominator = 8 * orders_[row];
+  if (numerator % denominator != 0) return false;
+  diagonal = CyclePhase(numerator / denominator, orders_[row]);
   return true;
 }
 
+/*!
+ * The elements are digits, the least significant being the one in the second
+ * column of the third row. Each time a digit is incremented, those below it
+ * have been reset, so Gauge::GSOHandler::Complete can settle whether any
+ * Gauge::GSOMatrix with the digits from there up is valid. When none is, and
+ * the digit is not in the second column, no other value of it can help either,
+ * and it is carried past at once.
+ */
 bool Gauge::GSOHandler::Next() {
-  for (int row = 2; row < kij_.size; ++row) {
-    for (int column = 1; column < row; ++column) {
-      if (IncrementElement(row,column)) {
-        if (!Validate()) return Next();
-        return true;
-      }
-      assert(MinimizeElement(row,column));
+  int row = 2, column = 1;
+  while (row < kij_.size) {
+    if (IncrementElement(row, column)) {
+      if (Complete(row, column)) return true;
+      if (column == 1) continue;
+    }
+    SetElement(row, column, 0);
+    if (++column == row) {
+      ++row;
+      column = 1;
     }
   }
   return false;
 }
 
-bool Gauge::GSOHandler::IncrementElement(int row, int column) {
-  int order = orders_[column];
-  Gauge::Math::Rational element = kij_.base[row][column];
-  Reduce(Add(&element, Gauge::Math::Rational(2,order)));
-  if (element > 1) return false;
-  while (!SetElement(row, column, element)) {
-    Reduce(Add(&element, Gauge::Math::Rational(2,order)));
-    if (element > 1) return false;
+/*!
+ * Only the reduced SUSY constraint, that some element of the second column
+ * below the diagonal be @c 1, reaches across elements. The smallest valid
+ * completion sets the least significant element of the second column that
+ * admits @c 1 and leaves the others at their first choice.
+ */
+bool Gauge::GSOHandler::Complete(int row, int column) {
+  if (Validate()) return true;
+  int last = (column > 1) ? row : row - 1;
+  for (int lower = 2; lower <= last; ++lower) {
+    if (ones_[lower] != -1) {
+      SetElement(lower, 1, ones_[lower]);
+      return true;
+    }
   }
+  return false;
+}
+
+bool Gauge::GSOHandler::IncrementElement(int row, int column) {
+  int index = indices_[row][column] + 1;
+  if (index == counts_[row][column]) return false;
+  SetElement(row, column, index);
   return true;
 }
 
+/*!
+ * The difference is accumulated in 64-bit integers and reduced after every
+ * element, so that its denominator stays a divisor of the product of the
+ * orders and the denominator of the state; unreduced, it overflows an @c int
+ * for three layers of large orders.
+ */
 bool Gauge::GSOHandler::PassesProjection(Gauge::Math::Rational *value,
                                          const Gauge::GSOMatrix &gso, int row,
                                          const int *coeff, int extra) {
   const Gauge::Math::Rational *kij;
-  int num = value->num, den = value->den;
-  int gso_num, gso_den;
+  int64_t num = value->num, den = value->den;
+  int64_t gso_num, gso_den;
   for (int index = 0; index < gso.size; ++index) {
     kij = &gso.base[row][index];
     gso_num = kij->num;
@@ -258,9 +701,194 @@ bool Gauge::GSOHandler::PassesProjection(Gauge::Math::Rational *value,
 
     num = num * gso_den - coeff[index] * gso_num * den;
     den *= gso_den;
+    int64_t a = (num < 0) ? -num : num, b = den;
+    while (b != 0) {
+      int64_t r = a % b;
+      a = b;
+      b = r;
+    }
+    if (a > 1) {
+      num /= a;
+      den /= a;
+    }
+  }
+  return num % (2 * den) == 0;
+}
+
+/*!
+ * A permutation of the basis vectors that preserves their orders and products
+ * is a symmetry of the Gauge::Basis when the fermions can be permuted to
+ * match, that is when the columns of the basis, read across the basis
+ * vectors, are the same multiset before and after. The same holds with the
+ * signs of some of the basis vectors changed first, which leaves the span of
+ * the basis as it is; the entries of @c 1 are their own negatives, so a basis
+ * vector of order @c 2 has only the one sign. The all periodic and SUSY basis
+ * vectors are unchanged by any permutation of the fermions.
+ *
+ * A basis vector can only be mapped to one with the same order, norm and
+ * product with the all periodic vector, so when no two of them share those
+ * the identity is the only permutation and the search without sign changes
+ * is skipped. This is always the case for a single basis vector.
+ */
+void Gauge::GSOHandler::ComputeAutomorphisms(const Gauge::Basis &basis) {
+  bool paired = false;
+  for (int row = extra_layers_; !paired && row < kij_.size; ++row) {
+    for (int other = extra_layers_; !paired && other < row; ++other) {
+      paired = orders_[row] == orders_[other] &&
+               products_[row][0] == products_[other][0] &&
+               products_[row][row] == products_[other][other];
+    }
+  }
+
+  int *image = new int[basis.size];
+  int *signs = new int[basis.size];
+  bool *used = new bool[basis.size];
+  for (int index = 0; index < basis.size; ++index) used[index] = false;
+  Gauge::Basis source(basis);
+  std::vector<std::vector<int> > products(kij_.size,
+                                          std::vector<int>(kij_.size, 0));
+  for (int mask = 0; mask < (1 << basis.size); ++mask) {
+    bool searched = paired || mask != 0;
+    for (int vector = 0; searched && vector < basis.size; ++vector) {
+      signs[vector] = ((mask >> vector) & 1) ? -1 : 1;
+      searched = signs[vector] == 1 || basis.base[vector].order > 2;
+    }
+    if (!searched) continue;
+
+    for (int vector = 0; vector < basis.size; ++vector) {
+      Gauge::BasisVector &negated = source.base[vector];
+      int order = basis.base[vector].order;
+      for (int k = 0; k < negated.size; ++k) {
+        int entry = basis.base[vector].base[k];
+        negated.base[k] = (signs[vector] == 1 || entry == order) ? entry :
+                                                                    -entry;
+      }
+    }
+    for (int row = extra_layers_; row < kij_.size; ++row) {
+      const Gauge::BasisVector &vector = source.base[row - extra_layers_];
+      Gauge::Math::Rational product =
+        Gauge::Math::Product(vector, Gauge::kPeriodicBasisVector);
+      products[row][0] = product.num * (orders_[row] * orders_[0] /
+                                        product.den);
+      for (int column = extra_layers_; column <= row; ++column) {
+        product = Gauge::Math::Product(vector,
+                                       source.base[column - extra_layers_]);
+        products[row][column] = product.num * (orders_[row] *
+                                               orders_[column] / product.den);
+      }
+    }
+    ExtendAutomorphism(basis, source, signs, products, 0, image, used);
+  }
+  delete [] used;
+  delete [] signs;
+  delete [] image;
+}
+
+void Gauge::GSOHandler::ExtendAutomorphism(
+    const Gauge::Basis &basis, const Gauge::Basis &source, const int *signs,
+    const std::vector<std::vector<int> > &products, int index, int *image,
+    bool *used) {
+  if (index < basis.size) {
+    int row = index + extra_layers_;
+    for (int target = 0; target < basis.size; ++target) {
+      int column = target + extra_layers_;
+      if (used[target] || orders_[column] != orders_[row]) continue;
+      if (products[row][0] != products_[column][0]) continue;
+      bool preserved = products[row][row] == products_[column][column];
+      for (int mapped = 0; preserved && mapped < index; ++mapped) {
+        int other = image[mapped] + extra_layers_;
+        int lhs = products[row][mapped + extra_layers_];
+        int rhs = (column > other) ? products_[column][other] :
+                                     products_[other][column];
+        preserved = lhs == rhs;
+      }
+      if (!preserved) continue;
+      image[index] = target;
+      used[target] = true;
+      ExtendAutomorphism(basis, source, signs, products, index + 1, image,
+                         used);
+      used[target] = false;
+    }
+    return;
+  }
+
+  bool identity = true;
+  for (int vector = 0; vector < basis.size; ++vector) {
+    identity = identity && image[vector] == vector && signs[vector] == 1;
+  }
+  if (identity) return;
+
+  int width = basis.base[0].size;
+  std::vector<std::vector<int> > columns(width), images(width);
+  for (int k = 0; k < width; ++k) {
+    columns[k].resize(basis.size);
+    images[k].resize(basis.size);
+    for (int vector = 0; vector < basis.size; ++vector) {
+      columns[k][vector] = basis.base[vector].base[k];
+      images[k][image[vector]] = source.base[vector].base[k];
+    }
+  }
+  std::sort(columns.begin(), columns.end());
+  std::sort(images.begin(), images.end());
+  if (columns != images) return;
+
+  for (int row = 0; row < kij_.size; ++row) {
+    bool extra = row < extra_layers_;
+    automorphisms_.push_back(extra ? row : image[row - extra_layers_] +
+                                           extra_layers_);
+    signs_.push_back(extra ? 1 : signs[row - extra_layers_]);
+  }
+}
+
+/*!
+ * Changing the signs of the basis vectors negates the lower-triangle elements
+ * whose row and column differ in sign, and the upper triangle follows from
+ * modular invariance, with the products the symmetry preserves. The
+ * permutation then moves the elements as they are, so an element that comes
+ * from the upper triangle is found from the lower-triangle one it pairs with.
+ */
+int Gauge::GSOHandler::ImagePhase(const int *map, const int *signs, int row,
+                                  int column) const {
+  int sign = signs[row] * signs[column];
+  if (map[row] > map[column]) {
+    return CyclePhase(sign * phases_[map[row]][map[column]], orders_[column]);
+  }
+  int tnemele = CyclePhase(sign * phases_[map[column]][map[row]],
+                           orders_[row]);
+  int numerator = products_[row][column] - 4 * tnemele * orders_[column];
+  assert(numerator % (4 * orders_[row]) == 0);
+  return CyclePhase(numerator / (4 * orders_[row]), orders_[column]);
+}
+
+/*!
+ * A symmetry maps the Gauge::GSOMatrix to one that builds the same model. The
+ * symmetries form a group, so each of them may stand in for its inverse, and
+ * the class has as many members as the group has elements over the number
+ * that leave the Gauge::GSOMatrix unchanged. The ranks are compared digit by
+ * digit, the most significant first, since the choices of each element are in
+ * the order of their phases.
+ */
+bool Gauge::GSOHandler::Representative() {
+  multiplicity_ = 1;
+  if (automorphisms_.empty()) return true;
+  int size = kij_.size;
+  int count = automorphisms_.size() / size;
+  uint64_t unchanged = 1;
+  for (int index = 0; index < count; ++index) {
+    const int *map = &automorphisms_[index * size];
+    const int *signs = &signs_[index * size];
+    int comparison = 0;
+    for (int row = size - 1; comparison == 0 && row > 0; --row) {
+      for (int column = row - 1; comparison == 0 && column >= 0; --column) {
+        comparison = ImagePhase(map, signs, row, column) -
+                     phases_[row][column];
+      }
+    }
+    if (comparison < 0) return false;
+    if (comparison == 0) ++unchanged;
   }
-  int gcd = Gauge::Math::GCD(num,den);
-  return (num/gcd) % (2 * den/gcd) == 0;
+  multiplicity_ = (count + 1) / unchanged;
+  return true;
 }
 
 bool Gauge::GSOHandler::Validate() const {
@@ -268,7 +896,7 @@ bool Gauge::GSOHandler::Validate() const {
     return true;
   }
   for (int row = 2; row < kij_.size; ++row) {
-    if (kij_.base[row][1] == 1) return true;
+    if (phases_[row][1] == 1) return true;
   }
   return false;
 }
@@ -24,6 +24,8 @@
 #include <cstdlib>
 #include <cassert>
 
+#include <algorithm>
+
 #include <GeometryFactory.h>
 
 Gauge::GeometryFactory::GeometryFactory(Gauge::BasisHandler *basis_handler,
@@ -33,8 +35,15 @@ Gauge::GeometryFactory::GeometryFactory(Gauge::BasisHandler *basis_handler,
   this->gso_handler_ = gso_handler;
   this->geometry_ = new Gauge::Geometry();
 
+  base_ = 0;
+  basis_ = 0;
+  end_ = 0;
   first_ = true;
+  holding_ = false;
+  overflow_ = false;
+  ranks_ = 0;
   setup_ = false;
+  target_ = 0;
 }
 
 Gauge::GeometryFactory::~GeometryFactory() {
@@ -49,40 +58,123 @@ Gauge::GeometryFactory *Gauge::GeometryFactory::GenericFactory(
   return new GeometryFactory(basis_handler, gso_handler);
 }
 
+/*!
+ * A pending Seek is carried out by moving the Gauge::BasisHandler straight to
+ * the basis owning the target, so that the bases before it, and whole inputs
+ * before it, are never constructed or set up in the Gauge::GSOHandler.
+ */
 bool Gauge::GeometryFactory::NextGeometry() {
   assert(setup_ && input_factory_ != NULL &&
          basis_handler_ != NULL && gso_handler_ != NULL);
 
-  if (first_) {
-    if (input_factory_->Next()) {
-      input_ = &input_factory_->Input();
-      basis_handler_->Setup(*input_);
-    } else {
-      return false;
-    }
+  if (holding_ && gso_handler_->NextGSOMatrix()) {
+    geometry_->gso_matrix = gso_handler_->GSOMatrix();
+    geometry_->multiplicity = gso_handler_->Multiplicity();
+    return true;
   }
+  holding_ = false;
 
-  if (first_ || !gso_handler_->NextGSOMatrix()) {
-    first_ = false;
-    while (basis_handler_->NextBasis()) {
-      gso_handler_->Setup(basis_handler_->basis(), input_->susy_type);
-      if (gso_handler_->NextGSOMatrix()) {
-        geometry_->basis = basis_handler_->basis();
-        geometry_->gso_matrix = gso_handler_->GSOMatrix();
-        return true;
-      }
+  while (true) {
+    if (first_ && !NextInput()) return false;
+    if (target_ > base_ && !overflow_) {
+      basis_handler_->Seek(std::max((target_ - base_) / ranks_,
+                                    basis_handler_->Position()));
+    }
+    if (!basis_handler_->NextBasis()) {
+      base_ = end_;
+      first_ = true;
+      continue;
+    }
+    basis_ = basis_handler_->Position() - 1;
+    gso_handler_->Setup(basis_handler_->basis(), input_->susy_type,
+                        basis_handler_->unchanged());
+    assert(overflow_ || gso_handler_->Ranks() <= ranks_);
+    uint64_t first = base_ + basis_ * ranks_;
+    if (target_ > first && !overflow_)
+      gso_handler_->Seek(Gauge::GSOSlice(target_ - first, ranks_));
+    if (gso_handler_->NextGSOMatrix()) {
+      holding_ = true;
+      geometry_->basis = basis_handler_->basis();
+      geometry_->gso_matrix = gso_handler_->GSOMatrix();
+      geometry_->multiplicity = gso_handler_->Multiplicity();
+      return true;
     }
-    first_ = true;
-    return NextGeometry();
   }
-  geometry_->gso_matrix = gso_handler_->GSOMatrix();
+}
+
+/*!
+ * The bases of the Gauge::Input are counted as soon as it is reached, so an
+ * overflow is caught before any of its ordinals is handed out.
+ */
+bool Gauge::GeometryFactory::NextInput() {
+  if (!input_factory_->Next()) return false;
+  input_ = &input_factory_->Input();
+  ranks_ = Gauge::GSOHandler::MaximumRanks(*input_);
+  basis_handler_->Setup(*input_);
+  uint64_t count = basis_handler_->Count();
+  overflow_ = overflow_ || ranks_ == 0 ||
+              count > (UINT64_MAX - base_) / ranks_;
+  end_ = overflow_ ? UINT64_MAX : base_ + count * ranks_;
+  first_ = false;
   return true;
 }
 
+/*!
+ * Before the first Gauge::Geometry of a basis, the position is the first
+ * ordinal of that basis; between inputs it is the first ordinal of the next
+ * one.
+ */
+uint64_t Gauge::GeometryFactory::Position() const {
+  assert(setup_);
+  if (overflow_) return UINT64_MAX;
+  if (first_) return base_;
+  if (!holding_) return base_ + basis_handler_->Position() * ranks_;
+  return base_ + basis_ * ranks_ + std::min(gso_handler_->Rank(), ranks_);
+}
+
+/*!
+ * When the ordinal is within the current basis, the Gauge::GSOHandler is
+ * moved to it directly; otherwise the rest of the current basis is given up
+ * and Gauge::GeometryFactory::NextGeometry moves to the basis owning it.
+ */
+void Gauge::GeometryFactory::Seek(uint64_t ordinal) {
+  assert(setup_ && ordinal >= Position());
+  target_ = ordinal;
+  if (!holding_ || overflow_) return;
+  uint64_t first = base_ + basis_ * ranks_;
+  if (ordinal < first + ranks_) {
+    gso_handler_->Seek(Gauge::GSOSlice(ordinal - first, ranks_));
+  } else {
+    holding_ = false;
+  }
+}
+
 void Gauge::GeometryFactory::Setup(Gauge::InputFactory::Generic *factory) {
   input_factory_ = factory;
+  base_ = 0;
+  basis_ = 0;
+  end_ = 0;
   first_ = true;
+  holding_ = false;
+  overflow_ = false;
+  ranks_ = 0;
   setup_ = true;
+  target_ = 0;
+}
+
+bool Gauge::GeometryFactory::SkipInput() {
+  assert(setup_ && input_factory_ != NULL && basis_handler_ != NULL);
+  if (first_ && !NextInput()) return false;
+  if (overflow_) return false;
+  base_ = end_;
+  first_ = true;
+  holding_ = false;
+  return true;
+}
+
+Gauge::GeometryFactory *Gauge::GeometryFactory::PermutationFactory() {
+  return new GeometryFactory(new Gauge::BasisHandler(),
+                             new Gauge::GSOHandler(true));
 }
 
 Gauge::GeometryFactory *Gauge::GeometryFactory::SystematicFactory() {
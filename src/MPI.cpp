@@ -46,25 +46,28 @@ int Gauge::MPI::ReceiveTag(int process, MPI_Comm comm) {
 }
 
 void Gauge::MPI::SendRaw(Gauge::Raw &raw, int process, int tag) {
-  int *size_ptr = const_cast<int *>(&raw.size);
-  char *data_ptr = const_cast<char *>(raw.data);
-  MPI_Send(size_ptr, 1, MPI_INT, process, tag, MPI_COMM_WORLD);
-  MPI_Send(data_ptr, raw.size, MPI_CHAR, process, tag, MPI_COMM_WORLD);
+  MPI_Send(raw.data, raw.size, MPI_CHAR, process, tag, MPI_COMM_WORLD);
 }
 
-Gauge::Raw *Gauge::MPI::ReceiveRaw(int process, int exit_tag) {
-  Gauge::Raw *raw = new Gauge::Raw();
+void Gauge::MPI::SendRaw(Gauge::Raw &raw, int process, int tag,
+                         MPI_Request *request) {
+  MPI_Isend(raw.data, raw.size, MPI_CHAR, process, tag, MPI_COMM_WORLD,
+      request);
+}
 
+Gauge::Raw *Gauge::MPI::ReceiveRaw(int process, int exit_tag) {
   MPI_Status status;
-  MPI_Recv(&raw->size, 1, MPI_INT, process, MPI_ANY_TAG, MPI_COMM_WORLD,
-      &status);
+  MPI_Probe(process, MPI_ANY_TAG, MPI_COMM_WORLD, &status);
   if (status.MPI_TAG == exit_tag) {
-    delete raw;
+    MPI_Recv(NULL, 0, MPI_INT, status.MPI_SOURCE, exit_tag, MPI_COMM_WORLD,
+        &status);
     return NULL;
   }
-  raw->data = new char[raw->size];
-  MPI_Recv(raw->data, raw->size, MPI_CHAR, process, MPI_ANY_TAG, MPI_COMM_WORLD,
-      &status);
-  if (status.MPI_TAG == exit_tag) delete raw;
+
+  int size;
+  MPI_Get_count(&status, MPI_CHAR, &size);
+  Gauge::Raw *raw = new Gauge::Raw(size);
+  MPI_Recv(raw->data, raw->size, MPI_CHAR, status.MPI_SOURCE, status.MPI_TAG,
+      MPI_COMM_WORLD, &status);
   return raw;
 }
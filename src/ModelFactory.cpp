@@ -41,6 +41,7 @@ Gauge::ModelFactory::ModelFactory() {
   layer_ = 0;
   number_of_sectors_ = 0;
   orders_ = NULL;
+  pooled_ = false;
   setup_ = false;
   width_ = 0;
 }
@@ -51,11 +52,15 @@ Gauge::ModelFactory::~ModelFactory() {
   ClearCoefficients();
   ClearStates();
   ClearGroups();
+  ClearPool();
 }
 
 void Gauge::ModelFactory::Setup(const Gauge::Geometry *geometry) {
   assert(geometry != NULL);
 
+  ClearPool();
+  batch_.clear();
+  multiplicities_.clear();
   ClearOrders();
   ClearSectors();
   ClearCoefficients();
@@ -83,6 +88,54 @@ void Gauge::ModelFactory::Setup(const Gauge::Geometry *geometry) {
   built_ = false;
 }
 
+/*!
+ * The sectors and the massless states before the GSO projection depend only
+ * on the Gauge::Basis and the size of the Gauge::GSOMatrix, so they are shared
+ * by the whole batch.
+ */
+void Gauge::ModelFactory::Setup(const Gauge::Geometry *const *geometries,
+                                int count) {
+  assert(0 < count && count <= kBatch);
+  Setup(geometries[0]);
+  for (int index = 0; index < count; ++index) {
+    assert(geometries[index]->basis == geometries[0]->basis);
+    assert(geometries[index]->gso_matrix.size ==
+           geometries[0]->gso_matrix.size);
+    batch_.push_back(geometries[index]->gso_matrix);
+    multiplicities_.push_back(geometries[index]->multiplicity);
+  }
+}
+
+/*!
+ * The first call constructs the sectors and projects every candidate state
+ * against the whole batch at once. Each call then only copies the survivors
+ * of its Gauge::GSOMatrix and resolves the groups.
+ */
+bool Gauge::ModelFactory::Build(int index) {
+  assert(setup_ && 0 <= index && index < static_cast<int>(batch_.size()));
+  if (!pooled_) {
+    pooled_ = true;
+    if (ConstructSectors()) ConstructPool();
+  }
+  if (sectors_.empty()) return false;
+
+  ClearStates();
+  ClearGroups();
+  model_.geometry->gso_matrix = batch_[index];
+  model_.geometry->multiplicity = multiplicities_[index];
+  model_.states.BySector() =
+      std::vector<std::list<Gauge::State*>>(number_of_sectors_);
+  for (size_t state = 0; state < pool_.size(); ++state) {
+    if ((masks_[state] >> index) & 1) {
+      model_.states.insert(new Gauge::State(*pool_[state]),
+                           pool_sectors_[state]);
+    }
+  }
+  ResolveGroups();
+  SetSUSY();
+  return true;
+}
+
 bool Gauge::ModelFactory::Build() {
   assert(setup_);
   if (built_) return built_;
@@ -124,6 +177,14 @@ void Gauge::ModelFactory::ClearOrders() {
   orders_ = NULL;
 }
 
+void Gauge::ModelFactory::ClearPool() {
+  for (size_t index = 0; index < pool_.size(); ++index) delete pool_[index];
+  pool_.clear();
+  pool_sectors_.clear();
+  masks_.clear();
+  pooled_ = false;
+}
+
 void Gauge::ModelFactory::ClearSectors() {
   sectors_.clear();
 }
@@ -233,7 +294,9 @@ void Gauge::ModelFactory::ConstructStates() {
   for (int index = 0; index < number_of_sectors_; ++index) {
     Gauge::State *state = new Gauge::State(*sectors_[index]);
     Gauge::Math::Rational mag = Gauge::Math::Magnitude(*state);
+    candidates_.clear();
     SelectF(0, state, mag.num, mag.den, index);
+    ProjectCandidates(index);
   }
 }
 
@@ -310,6 +373,67 @@ void Gauge::ModelFactory::RaiseState(int index, const Gauge::State *state,
   SelectF(index + 1, new_state, n, d, sector);
 }
 
+void Gauge::ModelFactory::ConstructPool() {
+  for (int index = 0; index < number_of_sectors_; ++index) {
+    Gauge::State *state = new Gauge::State(*sectors_[index]);
+    Gauge::Math::Rational mag = Gauge::Math::Magnitude(*state);
+    candidates_.clear();
+    SelectF(0, state, mag.num, mag.den, index);
+
+    int count = candidates_.size();
+    if (count == 0) continue;
+    std::vector<int> values(count * width_);
+    for (int candidate = 0; candidate < count; ++candidate) {
+      std::copy(candidates_[candidate]->base,
+                candidates_[candidate]->base + width_,
+                values.begin() + candidate * width_);
+    }
+    size_t first = pool_.size();
+    masks_.resize(first + count);
+    Gauge::GSOHandler::Project(model_.geometry->basis, batch_.data(),
+                               batch_.size(), values.data(), count,
+                               candidates_[0]->den, coefficients_[index],
+                               masks_.data() + first);
+    for (int candidate = 0; candidate < count; ++candidate) {
+      if (masks_[first + candidate] == 0) {
+        delete candidates_[candidate];
+        continue;
+      }
+      masks_[pool_.size()] = masks_[first + candidate];
+      pool_.push_back(candidates_[candidate]);
+      pool_sectors_.push_back(index);
+    }
+    masks_.resize(pool_.size());
+    candidates_.clear();
+  }
+}
+
+/*!
+ * The candidates of a sector share their denominator, so they are copied side
+ * by side and projected together.
+ */
+void Gauge::ModelFactory::ProjectCandidates(int sector) {
+  int count = candidates_.size();
+  if (count == 0) return;
+  std::vector<int> values(count * width_);
+  std::vector<char> survivors(count);
+  for (int index = 0; index < count; ++index) {
+    std::copy(candidates_[index]->base, candidates_[index]->base + width_,
+              values.begin() + index * width_);
+  }
+  Gauge::GSOHandler::Project(*model_.geometry, values.data(), count,
+                             candidates_[0]->den, coefficients_[sector],
+                             survivors.data());
+  for (int index = 0; index < count; ++index) {
+    if (survivors[index]) {
+      model_.states.insert(candidates_[index], sector);
+    } else {
+      delete candidates_[index];
+    }
+  }
+  candidates_.clear();
+}
+
 int Gauge::ModelFactory::RankA(int size) const {
   if (size < 1 || size > 253) return 0;
   double rank_double = (-1 + pow(1 + 8 * size, 0.5)) / 2;
@@ -417,11 +541,8 @@ void Gauge::ModelFactory::SelectF(int index, Gauge::State *state,
     while(trailing > -1 && state->base[trailing] == 0) --trailing;
     ++trailing;
     state->trailing = trailing;
-    if (Gauge::GSOHandler::Project(*model_.geometry, *state,
-                                   coefficients_[sector])) {
-      model_.states.insert(state, sector);
-      return;
-    }
+    candidates_.push_back(state);
+    return;
   }
   delete state;
 }
@@ -0,0 +1,156 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file src/NVectorCatalog.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief An implementation of the Gauge::NVectorCatalog class.
+ */
+
+// C Headers
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// C++ Headers
+#include <sstream>
+
+// Gauge Framework Headers
+#include <NVectorCatalog.h>
+
+std::string Gauge::NVectorCatalog::directory_;
+
+Gauge::NVectorCatalog::NVectorCatalog() {
+  data_ = NULL;
+  header_ = NULL;
+  length_ = 0;
+  records_ = NULL;
+  starts_ = NULL;
+}
+
+Gauge::NVectorCatalog::~NVectorCatalog() {
+  Close();
+}
+
+/*!
+ * Anything that does not look like a catalog of the expected orders and size,
+ * including one whose records are not @f$ \prod_l N_l - 1 @f$ values wide or
+ * a truncated file or one whose counts do not fit in it, is rejected so that
+ * the caller falls back to live enumeration.
+ */
+bool Gauge::NVectorCatalog::Open(const std::string &path, const int *orders,
+    int layers, int size) {
+  Close();
+  if (path.empty()) return false;
+  int descriptor = open(path.c_str(), O_RDONLY);
+  if (descriptor == -1) return false;
+  struct stat status;
+  if (fstat(descriptor, &status) == -1 ||
+      static_cast<size_t>(status.st_size) < sizeof(Header)) {
+    close(descriptor);
+    return false;
+  }
+  length_ = status.st_size;
+  data_ = mmap(NULL, length_, PROT_READ, MAP_SHARED, descriptor, 0);
+  close(descriptor);
+  if (data_ == MAP_FAILED) {
+    data_ = NULL;
+    return false;
+  }
+
+  const Header *header = static_cast<const Header*>(data_);
+  const char *base = static_cast<const char*>(data_);
+  bool valid = memcmp(header->magic, "GNVC", 4) == 0 &&
+    header->version == kVersion &&
+    header->layers == static_cast<uint32_t>(layers) &&
+    header->size == static_cast<uint32_t>(size);
+  if (valid) {
+    const uint32_t *stored = reinterpret_cast<const uint32_t*>(header + 1);
+    uint64_t width = 1;
+    for (int l = 0; l < layers; ++l) {
+      valid = valid && stored[l] == static_cast<uint32_t>(orders[l]);
+      width *= orders[l];
+    }
+    valid = valid && header->width == width - 1;
+    // The table of starts and the records are bounded by the length of the
+    // file before any offset is computed from them, so that neither can
+    // overflow.
+    uint64_t fixed = RecordOffset(layers, 0) - sizeof(uint64_t);
+    valid = valid && length_ >= fixed &&
+      header->ordinals < (length_ - fixed) / sizeof(uint64_t);
+    if (valid) {
+      uint64_t offset = RecordOffset(layers, header->ordinals);
+      valid = length_ >= offset && header->width > 0 &&
+        header->count <= (length_ - offset) / header->width;
+    }
+  }
+  if (!valid) {
+    Close();
+    return false;
+  }
+  header_ = header;
+  // The table of starts ends where the records begin.
+  starts_ = reinterpret_cast<const uint64_t*>(base +
+      RecordOffset(layers, header->ordinals)) - (header->ordinals + 1);
+  records_ = reinterpret_cast<const unsigned char*>(base +
+      RecordOffset(layers, header->ordinals));
+  madvise(data_, length_, MADV_SEQUENTIAL);
+  return true;
+}
+
+void Gauge::NVectorCatalog::Close() {
+  if (data_ != NULL) munmap(data_, length_);
+  data_ = NULL;
+  header_ = NULL;
+  length_ = 0;
+  records_ = NULL;
+  starts_ = NULL;
+}
+
+/*!
+ * Catalogs are named after their orders and size, for example
+ * @c nvectors-2_2_3-22.cat.
+ */
+std::string Gauge::NVectorCatalog::Path(const int *orders, int layers,
+    int size) {
+  if (directory_.empty()) return std::string();
+  std::ostringstream path;
+  path << directory_;
+  if (directory_[directory_.size() - 1] != '/') path << '/';
+  path << "nvectors-";
+  for (int l = 0; l < layers; ++l) path << (l == 0 ? "" : "_") << orders[l];
+  path << '-' << size << ".cat";
+  return path.str();
+}
+
+void Gauge::NVectorCatalog::SetDirectory(const std::string &directory) {
+  directory_ = directory;
+}
+
+/*!
+ * The orders are padded to a multiple of eight bytes so that the table of
+ * starts, which holds one more entry than there are layer @c 0 solutions, is
+ * aligned.
+ */
+uint64_t Gauge::NVectorCatalog::RecordOffset(int layers, uint64_t ordinals) {
+  uint64_t orders = (sizeof(uint32_t) * layers + 7) / 8 * 8;
+  return sizeof(Header) + orders + sizeof(uint64_t) * (ordinals + 1);
+}
@@ -29,9 +29,16 @@
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+
+// C++ Headers
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 // Gauge Framework Headers
 #include <Math.h>
+#include <NVectorCatalog.h>
 #include <NVectorHandler.h>
 
 /*!
@@ -41,73 +48,81 @@ Gauge::NVectorHandler::NVectorHandler() {
   amatrix_ = NULL;
   avalue_ = 0;
   barriers_ = NULL;
+  begin_ = 0;
+  changed_ = 0;
   conjugates_ = NULL;
   constraints_ = NULL;
+  container_ = NULL;
+  counting_ = false;
   current_ = 0;
-  holders_ = NULL;
+  distribute_ = false;
+  end_ = UINT64_MAX;
+  exhausted_ = false;
+  frames_ = NULL;
   layer_ = 0;
   moduli_ = NULL;
   multiplicity_ = NULL;
   orders_ = NULL;
+  partners_ = NULL;
+  position_ = 0;
   replication_ = NULL;
+  residues_ = NULL;
   setup_ = false;
   size_ = 0;
   solution_ = NULL;
+  skip_ = UINT64_MAX;
   solvers_ = NULL;
+  steps_ = 0;
+  tally_ = 0;
+  touched_ = 0;
 }
 
 /*!
  * The destructor deallocates the following dynamically allocated pointers:
- *  - Gauge::NVectorHandler::amatrix_
- *  - Gauge::NVectorHandler::barriers_
- *  - Gauge::NVectorHandler::conjugates_
- *  - Gauge::NVectorHandler::constraints_
- *  - Gauge::NVectorHandler::holders_
- *  - Gauge::NVectorHandler::moduli_
- *  - Gauge::NVectorHandler::multiplicity_
- *  - Gauge::NVectorHandler::orders_
- *  - Gauge::NVectorHandler::replication_
+ *  - Gauge::NVectorHandler::container_
+ *  - Gauge::NVectorHandler::frames_
+ *  - Gauge::NVectorHandler::partners_
+ *  - Gauge::NVectorHandler::residues_
  *  - Gauge::NVectorHandler::solution_
  *  - Gauge::NvectorHandler::solvers_
+ *
+ * The setup tables are shared by every handler with the same orders and are
+ * never released.
  */
 Gauge::NVectorHandler::~NVectorHandler() {
-  if (amatrix_ != NULL) {
-    for (int index = 0; index < layer_; ++index) {
-      if (amatrix_[index] != NULL) delete [] amatrix_[index];
-    }
-    delete [] amatrix_;
-  }
-  if (barriers_ != NULL) delete [] barriers_;
-  if (conjugates_ != NULL) delete [] conjugates_;
-  if (constraints_ != NULL) {
-    int number_of_constraints = layer_*(layer_-1)/2;
-    for (int index = 0; index < number_of_constraints; ++index) {
-      if (constraints_[index] != NULL) delete [] constraints_[index];
-    }
-    delete [] constraints_;
-  }
-  if (holders_ != NULL) delete [] holders_;
-  if (moduli_ != NULL) delete [] moduli_;
-  if (multiplicity_ != NULL) delete [] multiplicity_;
-  if (orders_ != NULL) delete [] orders_;
-  if (replication_ != NULL) delete [] replication_;
+  if (container_ != NULL) delete [] container_;
+  if (frames_ != NULL) delete [] frames_;
+  if (partners_ != NULL) delete [] partners_;
+  if (residues_ != NULL) delete [] residues_;
   if (solution_ != NULL) delete solution_;
   if (solvers_ != NULL) delete [] solvers_;
 }
 
 /*!
- * This method is simply a public interface to the
- * Gauge::NVectorHandler::FindNextSolution. Essentially, it removes the need to
- * provide a boolean argument specifying the need to distribute the solution.
+ * This method simply steps the search until it either finds a solution or
+ * exhausts the search space. The first column touched on the way is reported
+ * as Gauge::NVectorHandler::changed_.
+ *
+ * @see Gauge::NVectorHandler::Step
  */
 bool Gauge::NVectorHandler::NextSolution() {
   assert(setup_);
-  return FindNextSolution(holders_[current_] != NULL);
+  StepResult result;
+  do {
+    result = Step();
+  } while (result == kContinue);
+  if (result != kSolution) return false;
+  changed_ = touched_;
+  touched_ = avalue_;
+  return true;
 }
 
 /*!
  * The Setup method makes calls to private, working methods to setup the
  * Gauge::NVectorHandler for use. The following steps are taken:
+ *  - Look up the shared tables for the orders, building them the first time
+ *    they are needed.
+ *      (Gauge::NVectorHandler::SetupTables)
  *  - Calculate the multiplicity and replication.
  *      (Gauge::NVectorHandler::multiplicity_,
  *       Gauge::NVectorHandler::replication_,
@@ -128,8 +143,13 @@ bool Gauge::NVectorHandler::NextSolution() {
  *  - Setup the solvers.
  *      (Gauge::NVectorHandler::solvers_,
  *       Gauge::NVectorHandler::SetupSolvers)
- *  - Set the current layer to @c 0.
- *      (Gauge::NVectorHandler::current_)
+ *  - Set the current layer to @c 0 and empty the frame stack.
+ *      (Gauge::NVectorHandler::current_,
+ *       Gauge::NVectorHandler::distribute_)
+ *  - Enumerate every layer @c 0 solution, that is the whole search space.
+ *      (Gauge::NVectorHandler::begin_,
+ *       Gauge::NVectorHandler::end_,
+ *       Gauge::NVectorHandler::position_)
  *  - Initialize the current solution.
  *      (Gauge::NVectorHandler::solution_)
  *  - Setup the current equation.
@@ -142,10 +162,9 @@ void Gauge::NVectorHandler::Setup(const int *orders, int layers, int size) {
   assert(size <= 22 && size >= 16);
   for (int i = 0; i < layers; ++i) assert(orders[i] >= 2 && orders[i] < 100);
 
-  // Copy the provided array of orders to the internal storage.
-  if (orders_ != NULL) delete [] orders_;
-  orders_ = new int[layers];
-  for (int index = 0; index < layers; ++index) orders_[index] = orders[index];
+  // A handler set up again for the same orders keeps the tables it has.
+  bool shared = setup_ && layers == layer_ &&
+    std::equal(orders, orders + layers, orders_);
 
   // Set @c this->layer_ from input.
   layer_ = layers;
@@ -156,15 +175,21 @@ void Gauge::NVectorHandler::Setup(const int *orders, int layers, int size) {
   // Calculate the avalue (product of orders less one).
   avalue_ = Gauge::Math::Product(orders, orders+layers, 1) - 1;
 
-  SetupMultiplicities();  // Setup the multiplicity and replication arrays.
-  SetupAMatrix();         // Setup the a-matrix and barriers.
-  SetupConstraints();     // Setup the moduli and modular invariance constraints
-  if (layer_ != 1) {
-    SetupConjugates();    // Determine which n-values are conjugates.
-  }
+  if (!shared) SetupTables(orders);  // Share or build the tables below.
   SetupSolvers();         // Setup the layer one solvers.
 
   current_ = 0;
+  distribute_ = false;
+  steps_ = 0;
+  begin_ = 0;
+  end_ = UINT64_MAX;
+  exhausted_ = false;
+  position_ = 0;
+  skip_ = UINT64_MAX;
+  changed_ = 0;
+  touched_ = 0;
+  tally_ = 0;
+  tallies_.clear();
   if (solution_ != NULL) delete solution_;
   solution_ = new Gauge::NVector(avalue_);
   SetupEquation();
@@ -172,6 +197,162 @@ void Gauge::NVectorHandler::Setup(const int *orders, int layers, int size) {
   setup_ = true;
 }
 
+/*!
+ * We run the usual Setup and then restrict the layer @c 0 solutions to those
+ * owned by the slice. The frame stack is not saved with the slice, so the
+ * Gauge::NVectors it has already produced are skipped by their counts, which
+ * costs about as much as Gauge::NVectorHandler::Count of the part skipped
+ * rather than its enumeration.
+ *
+ * @see Gauge::NVectorHandler::Skip
+ */
+void Gauge::NVectorHandler::Setup(const Gauge::NVectorSlice &slice) {
+  assert(slice.begin <= slice.end);
+  Setup(slice.orders, slice.layers, slice.size);
+  begin_ = slice.begin;
+  end_ = slice.end;
+  Skip(slice.position);
+}
+
+/*!
+ * The layer @c 0 solutions depend only upon the order of the first layer and
+ * the size, so we count them with a scratch Gauge::NVectorHandler::Solver set
+ * up exactly as Gauge::NVectorHandler::SetupEquation would for layer @c 0. The
+ * count is then dealt out into adjacent ranges, the first few ranges taking
+ * one extra solution each when the count does not divide evenly.
+ */
+void Gauge::NVectorHandler::Split(int parts, Gauge::NVectorSlice *slices)
+    const {
+  assert(setup_ && parts > 0);
+  Solver solver;
+  solver.Setup(orders_[0], size_, moduli_[0]);
+  uint64_t count = 0;
+  while (solver.NextSolution()) ++count;
+
+  uint64_t share = count / parts;
+  uint64_t extra = count % parts;
+  uint64_t begin = 0;
+  for (int part = 0; part < parts; ++part) {
+    uint64_t end = begin + share;
+    if (static_cast<uint64_t>(part) < extra) ++end;
+    slices[part] = Gauge::NVectorSlice(orders_, layer_, size_, begin, end);
+    begin = end;
+  }
+}
+
+Gauge::NVectorSlice Gauge::NVectorHandler::Slice() const {
+  assert(setup_);
+  Gauge::NVectorSlice slice(orders_, layer_, size_, begin_, end_);
+  slice.position = position_;
+  return slice;
+}
+
+/*!
+ * The weights are the exact counts of the Gauge::NVectors descending from
+ * every layer @c 0 solution. Slice @f$ k @f$ ends at the first layer @c 0
+ * solution whose running weight reaches @f$ (k + 1)/P @f$ of the total.
+ */
+void Gauge::NVectorHandler::SplitByWeight(int parts,
+    Gauge::NVectorSlice *slices) const {
+  assert(setup_ && parts > 0);
+  if (layer_ == 1) {
+    Split(parts, slices);
+    return;
+  }
+  std::vector<uint64_t> weights;
+  uint64_t total = CountRange(0, UINT64_MAX, &weights);
+  Solver solver;
+  solver.Setup(orders_[0], size_, moduli_[0]);
+  uint64_t ordinals = 0;
+  while (solver.NextSolution()) ++ordinals;
+  weights.resize(ordinals, 0);
+
+  uint64_t begin = 0, end = 0, running = 0;
+  for (int part = 0; part < parts; ++part) {
+    long double target = static_cast<long double>(total) * (part + 1) / parts;
+    while (end < weights.size() && running < target) running += weights[end++];
+    if (part == parts - 1) end = weights.size();
+    slices[part] = Gauge::NVectorSlice(orders_, layer_, size_, begin, end);
+    begin = end;
+  }
+}
+
+uint64_t Gauge::NVectorHandler::Count() const {
+  assert(setup_);
+  return CountRange(begin_, end_, NULL);
+}
+
+uint64_t Gauge::NVectorHandler::Count(uint64_t begin, uint64_t end) const {
+  assert(setup_ && begin <= end);
+  return CountRange(begin, end, NULL);
+}
+
+uint64_t Gauge::NVectorHandler::Count(std::vector<uint64_t> *weights) const {
+  assert(setup_ && weights != NULL);
+  weights->clear();
+  return CountRange(begin_, end_, weights);
+}
+
+/*!
+ * The catalog is written to a temporary file beside the path and moved into
+ * place once complete, so that a reader never maps a partial catalog. The
+ * starts of the layer @c 0 solutions are collected while the records stream
+ * out and are written last, along with the count, into the space reserved for
+ * them.
+ */
+bool Gauge::NVectorHandler::Export(const std::string &path) const {
+  assert(setup_);
+  Solver solver;
+  solver.Setup(orders_[0], size_, moduli_[0]);
+  uint64_t ordinals = 0;
+  while (solver.NextSolution()) ++ordinals;
+  std::vector<uint64_t> starts(ordinals + 1, 0);
+
+  Gauge::NVectorCatalog::Header header;
+  memcpy(header.magic, "GNVC", 4);
+  header.version = Gauge::NVectorCatalog::kVersion;
+  header.layers = layer_;
+  header.size = size_;
+  header.width = avalue_;
+  header.reserved = 0;
+  header.count = 0;
+  header.ordinals = ordinals;
+
+  std::string temporary = path + ".tmp";
+  FILE *file = fopen(temporary.c_str(), "wb");
+  if (file == NULL) return false;
+  uint64_t offset = Gauge::NVectorCatalog::RecordOffset(layer_, ordinals);
+  std::vector<char> front(offset, 0);
+  for (int l = 0; l < layer_; ++l) {
+    uint32_t order = orders_[l];
+    memcpy(&front[sizeof(header) + l * sizeof(order)], &order, sizeof(order));
+  }
+  bool written = fwrite(&front[0], 1, offset, file) == offset;
+
+  Gauge::NVectorHandler walk;
+  walk.Setup(orders_, layer_, size_);
+  std::vector<unsigned char> record(avalue_);
+  uint64_t next = 0;
+  while (written && walk.NextSolution()) {
+    uint64_t ordinal = walk.frames_[0].solutions - 1;
+    for (; next <= ordinal; ++next) starts[next] = header.count;
+    for (int i = 0; i < avalue_; ++i) record[i] = walk.solution_->base[i];
+    written = fwrite(&record[0], 1, avalue_, file) ==
+      static_cast<size_t>(avalue_);
+    ++header.count;
+  }
+  for (; next <= ordinals; ++next) starts[next] = header.count;
+
+  written = written && fseek(file, 0, SEEK_SET) == 0 &&
+    fwrite(&header, sizeof(header), 1, file) == 1 &&
+    fseek(file, offset - sizeof(uint64_t) * (ordinals + 1), SEEK_SET) == 0 &&
+    fwrite(&starts[0], sizeof(uint64_t), ordinals + 1, file) == ordinals + 1;
+  written = (fclose(file) == 0) && written;
+  if (written) written = rename(temporary.c_str(), path.c_str()) == 0;
+  if (!written) remove(temporary.c_str());
+  return written;
+}
+
 /*!
  * The default constructor simply initializes the
  * Gauge::NVectorHandler::Solver::coefficients_ array to @c NULL and sets the
@@ -179,6 +360,7 @@ void Gauge::NVectorHandler::Setup(const int *orders, int layers, int size) {
  */
 Gauge::NVectorHandler::Solver::Solver() {
   coefficients_ = NULL;
+  feasibility_ = NULL;
   setup_ = false;
 }
 
@@ -199,6 +381,8 @@ Gauge::NVectorHandler::Solver::~Solver() {
  *        (Gauge::NVectorHandler::Solver::coefficients_)
  *    -# Initalize the coefficients.
  *        (Gauge::NVectorHandler::Solver::coefficients_)
+ *    -# Fetch the feasibility table shared by solvers of this order.
+ *        (Gauge::NVectorHandler::Solver::feasibility_)
  *    -# Initialize the flag signifying that we have not found yet solutions.
  *        (Gauge::NVectorHandler::Solver::first_)
  *    -# Initalize the maximum size.
@@ -222,6 +406,7 @@ void Gauge::NVectorHandler::Solver::Setup(int order, int maximum_size, int
   if (coefficients_ != NULL) delete [] coefficients_;
   coefficients_ = new int[width];
   for (int i = 0; i < width; ++i) coefficients_[i] = (width - i) * (width - i);
+  feasibility_ = &FeasibilityTable(order);
   first_ = true;
   maximum_size_ = maximum_size;
   minimum_total_ = minimum_total;
@@ -390,62 +575,95 @@ bool Gauge::NVectorHandler::Solver::Maximize() {
 
 int Gauge::NVectorHandler::Solver::MaximizeSegment(Gauge::NVector &nvector,
     int index, int target_total, int maximum_size) {
-  /*! We start by bounds checking our index. */
-  if (index >= nvector.size) return -1;
-
-  /*!
-   * Next we store the current element's value so we can reset it if fail to
-   * maximize the segment.
-   */
-  int previous_value = nvector.base[index];
-
   /*!
-   * We now calculate the maximum value that the current element can hold.
-   * If it will cause us to exceed the maximum size, we exit. Otherwise we set
-   * the element's value.
+   * We start by bounds checking our index and consulting the feasibility
+   * table. If the end-segment cannot reach the target total we exit without
+   * touching the Gauge::NVector.
    */
-  int delta = target_total/coefficients_[index];
-  if (maximum_size < delta) return -1;
-  nvector.base[index] = delta;
-
-  /*!
-   * In the case that this is the last element of the solution, we return its
-   * value.
-   */
-  if (index == nvector.size - 1) return nvector.base[index];
+  if (index >= nvector.size) return -1;
+  if (!Feasible(index, target_total, maximum_size)) return -1;
 
   /*!
-   * We now loop through attempting to maximize the end-segment that follows the
-   * current element. If we can't we decrement the current element's value and
-   * try again with the adjusted total.
-   *
-   * If we succeed at maximizing the subsequent end-segment we add the current
-   * element's value to the returned size and return that value.
+   * Otherwise we walk the end-segment from left to right, giving each element
+   * the largest value for which the remainder of the end-segment can still
+   * reach the remaining total. This is the same segment the exhaustive search
+   * would have settled on first.
    */
-  int next_total = target_total - (nvector.base[index] * coefficients_[index]);
-  int next_size = maximum_size - nvector.base[index];
+  int last = nvector.size - 1;
   int size = 0;
-  if (index < nvector.size - 1) {
-    while (nvector.base[index] > 0) {
-      size = MaximizeSegment(nvector, index + 1, next_total, next_size);
-      if (size != -1) return size + nvector.base[index];
-      --nvector.base[index];
-      next_total += coefficients_[index];
-      ++next_size;
-    }
+  for (int i = index; i < last; ++i) {
+    int value = target_total/coefficients_[i];
+    if (value > maximum_size) value = maximum_size;
+    while (!Feasible(i + 1, target_total - value * coefficients_[i],
+          maximum_size - value)) --value;
+    nvector.base[i] = value;
+    target_total -= value * coefficients_[i];
+    maximum_size -= value;
+    size += value;
   }
 
   /*!
-   * In the case that we have yet to succeed at maximizing the end-segment we
-   * attempt once more with the current element set to zero. In the case of
-   * success we return the new size otherwise we undo our hard work and return
-   * @c -1.
+   * The last coefficient is always @f$ 1 @f$, so the last element takes
+   * whatever total remains.
    */
-  size = MaximizeSegment(nvector,index+1, target_total, maximum_size);
+  nvector.base[last] = target_total;
+  return size + target_total;
+}
+
+/*!
+ * The tables are built lazily under a lock, one per order, and cached for the
+ * life of the process.
+ *
+ * Row @f$ k @f$ is built from row @f$ k + 1 @f$ with the usual unbounded
+ * knapsack recurrence
+ * @f[
+ *    s_k(t) = \min\left(s_{k+1}(t), 1 + s_k(t - c_k)\right),
+ * @f]
+ * starting from @f$ s_{w-1}(t) = t @f$ since the last coefficient is @f$ 1 @f$.
+ * All sizes are clamped to @f$ 23 @f$ so that they fit in a byte.
+ */
+const Gauge::NVectorHandler::Solver::Table&
+Gauge::NVectorHandler::Solver::FeasibilityTable(int order) {
+  static std::mutex lock;
+  static Table *tables[100] = {NULL};
+  assert(order > 1 && order < 100);
 
-  if (size == -1) nvector.base[index] = previous_value;
+  std::lock_guard<std::mutex> guard(lock);
+  if (tables[order] != NULL) return *tables[order];
 
-  return size;
+  const unsigned char kInfeasible = 23;
+  int width = order/2;
+  Table *table = new Table;
+  table->width = width;
+  table->limits = new int[width];
+  table->offsets = new int[width];
+  int length = 0;
+  for (int k = 0; k < width; ++k) {
+    table->limits[k] = 22 * (width - k) * (width - k);
+    table->offsets[k] = length;
+    length += table->limits[k] + 1;
+  }
+  table->sizes = new unsigned char[length];
+
+  unsigned char *row = table->sizes + table->offsets[width - 1];
+  for (int t = 0; t <= table->limits[width - 1]; ++t) {
+    row[t] = (t < kInfeasible) ? t : kInfeasible;
+  }
+  for (int k = width - 2; k >= 0; --k) {
+    int coefficient = (width - k) * (width - k);
+    unsigned char *next = table->sizes + table->offsets[k + 1];
+    row = table->sizes + table->offsets[k];
+    for (int t = 0; t <= table->limits[k]; ++t) {
+      unsigned char best = (t <= table->limits[k + 1]) ? next[t] : kInfeasible;
+      if (t >= coefficient && row[t - coefficient] + 1 < best) {
+        best = row[t - coefficient] + 1;
+      }
+      row[t] = best;
+    }
+  }
+
+  tables[order] = table;
+  return *table;
 }
 
 /*!
@@ -468,6 +686,15 @@ bool Gauge::NVectorHandler::DistributeSolution() {
   return false;
 }
 
+/*!
+ * Conjugate values always share a segment, since they share the absolute
+ * values of their a-matrix column; Gauge::NVectorHandler::CheckConjugates
+ * verifies this when the tables are built. Within the segment the conjugate
+ * ordering is built into Gauge::NVectorHandler::DistributeArray. The pairs
+ * outside of it are unchanged by the distribution, so they are checked only
+ * once: when they are out of order no distribution can pass and the segment is
+ * collapsed.
+ */
 bool Gauge::NVectorHandler::DistributeInSegment(int equation, int segment) {
   int order = orders_[equation];
   bool has_partner = !((order & 1) == 0 && segment == 0);
@@ -480,149 +707,275 @@ bool Gauge::NVectorHandler::DistributeInSegment(int equation, int segment) {
   int start2 = midpoint + segment * multiplicity;
   if ((order & 1) == 0) start2 -= multiplicity;
 
-  int *container = new int[size];
-  for (int i = 0; i < multiplicity; ++i) {
-    container[i] = solution_->base[start + i];
-    if (has_partner) container[multiplicity + i] = solution_->base[start2 + i];
+  int column, conjugate;
+  for (int i = 0; i < size; ++i) {
+    column = (i < multiplicity) ? start + i : start2 + i - multiplicity;
+    container_[i] = solution_->base[column];
+    conjugate = conjugates_[column];
+    if (conjugate >= column) {
+      partners_[i] = -1;
+    } else if (has_partner && conjugate >= start2) {
+      partners_[i] = multiplicity + conjugate - start2;
+    } else {
+      assert(conjugate >= start && conjugate < start + multiplicity);
+      partners_[i] = conjugate - start;
+    }
   }
 
-  while (DistributeArray(container, size)) {
-    for (int i = 0; i < multiplicity; ++i) {
-      solution_->base[start + i] = container[i];
-      if (has_partner) solution_->base[start2 + i] = container[multiplicity + i];
-    }
-    if (!IsValid(equation)) continue;
-    for (int i = 0; i < avalue_; ++i) {
-      if (conjugates_[i] > i &&
-          solution_->base[i] < solution_->base[conjugates_[i]]) {
-        goto step;
+  bool ordered = true;
+  for (int i = 0; i < avalue_ && ordered; ++i) {
+    if (conjugates_[i] <= i) continue;
+    if ((i >= start && i < start + multiplicity) ||
+        (has_partner && i >= start2 && i < start2 + multiplicity)) continue;
+    ordered = solution_->base[i] >= solution_->base[conjugates_[i]];
+  }
+
+  // Only the elements from the first one changed by a step are copied back to
+  // the solution, along with their contribution to the residues. A step
+  // refills the whole suffix after the element it decrements, so any element
+  // of it may change and the walk is no longer than the step itself;
+  // ApplyDelta returns at once for the elements that kept their value, so the
+  // residues are still updated only for those that changed.
+  int first;
+  if (ordered) {
+    while (DistributeArray(container_, size, partners_, &first)) {
+      for (int i = first; i < size; ++i) {
+        column = (i < multiplicity) ? start + i : start2 + i - multiplicity;
+        ApplyDelta(equation, column, container_[i] - solution_->base[column]);
       }
+      if (IsValid(equation)) return true;
+    }
+  } else {
+    for (int i = 1; i < size; ++i) {
+      container_[0] += container_[i];
+      container_[i] = 0;
     }
-    delete [] container;
-    return true;
-    step:;
   }
-  for (int i = 0; i < multiplicity; ++i) {
-    solution_->base[start + i] = container[i];
-    if (has_partner) solution_->base[start2 + i] = container[multiplicity + i];
+  for (int i = 0; i < size; ++i) {
+    column = (i < multiplicity) ? start + i : start2 + i - multiplicity;
+    ApplyDelta(equation, column, container_[i] - solution_->base[column]);
   }
-  delete [] container;
   return false;
 }
 
-bool Gauge::NVectorHandler::DistributeArray(int *array, int size) {
-  for (int i = size - 1; i >= 0; --i) {
-    if (array[i] != 0 && i == size - 1) {
-      int j = i - 1;
-      while (j >= 0) {
-        if (array[j] != 0) {
-          array[j + 1] = array[i] + 1;
-          if (j != i - 1) array[i] = 0;
-          --array[j];
-          break;
+/*!
+ * The segments are laid out exactly as in
+ * Gauge::NVectorHandler::DistributeInSegment. Each column is labelled with the
+ * segment that distributes it, and each conjugate pair must carry a single
+ * label.
+ */
+void Gauge::NVectorHandler::CheckConjugates() const {
+  int *segments = new int[avalue_];
+  for (int column = 0; column < avalue_; ++column) segments[column] = -1;
+  int label = 0;
+  for (int equation = 0; equation < layer_; ++equation) {
+    int order = orders_[equation];
+    int multiplicity = multiplicity_[equation];
+    int left = (equation == 0) ? 0 : barriers_[equation - 1];
+    int midpoint = left + (order/2) * multiplicity;
+    for (int segment = 0; segment < order/2; ++segment, ++label) {
+      bool has_partner = !((order & 1) == 0 && segment == 0);
+      int start = left + segment * multiplicity;
+      int start2 = midpoint + segment * multiplicity;
+      if ((order & 1) == 0) start2 -= multiplicity;
+      for (int i = 0; i < multiplicity; ++i) {
+        segments[start + i] = label;
+        if (has_partner) segments[start2 + i] = label;
+      }
+    }
+  }
+  for (int column = 0; column < avalue_; ++column) {
+    int conjugate = conjugates_[column];
+    if (conjugate == column) continue;
+    assert(segments[column] >= 0 && segments[column] == segments[conjugate]);
+  }
+  delete [] segments;
+}
+
+/*!
+ * The next distribution keeps the longest possible prefix: we look for the
+ * last element that can give up a unit such that the elements after it can
+ * hold what is left without breaking the conjugate ordering, and then fill
+ * those elements greedily. Taking as much as possible early never costs a
+ * later element capacity, so if the greedy completion fails no smaller value
+ * of the element can succeed either.
+ *
+ * A single element has no other distribution, and is already collapsed.
+ */
+bool Gauge::NVectorHandler::DistributeArray(int *array, int size,
+    const int *partners, int *first) {
+  if (size == 1) return false;
+  int rest = array[size - 1];
+  for (int i = size - 2; i >= 0; --i) {
+    if (array[i] != 0) {
+      --array[i];
+      int left = rest + 1;
+      int j = i + 1;
+      for (; j < size; ++j) {
+        int value = left;
+        if (partners[j] >= 0 && array[partners[j]] < value) {
+          value = array[partners[j]];
         }
-        --j;
+        array[j] = value;
+        left -= value;
       }
-      if (j >= 0) return true;
-      for (int i = 1; i < size; ++i) {
-        array[0] += array[i];
-        array[i] = 0;
+      if (left == 0) {
+        *first = i;
+        return true;
       }
-      return false;
-    } else if (array[i] != 0) {
-      --array[i];
-      ++array[i + 1];
-      return true;
+      rest += array[i] + 1;
+      array[i] = 0;
     }
   }
+  array[0] += rest;
+  for (int i = 1; i < size; ++i) array[i] = 0;
   return false;
 }
 
 bool Gauge::NVectorHandler::IsValid(int equation) {
+  const int *residues = residues_ + equation * layer_;
   for (int i = equation + 1; i < layer_; ++i) {
+#ifdef GAUGE_DEBUG
+    assert(residues[i] == Residue(equation, i));
+#endif
     int index = equation + i + layer_ - 1;
-    int value = 0;
-    for (int j = 0; j < barriers_[equation]; ++j) {
-      value += solution_->base[j] * amatrix_[equation][j] * amatrix_[i][j];
-    }
-    if (value % moduli_[index] != 0) return false;
+    if (residues[i] % moduli_[index] != 0) return false;
   }
   return true;
 }
 
+int Gauge::NVectorHandler::Residue(int equation, int layer) const {
+  int value = 0;
+  for (int j = 0; j < barriers_[equation]; ++j) {
+    value += solution_->base[j] * amatrix_[equation][j] * amatrix_[layer][j];
+  }
+  return value;
+}
+
+/*!
+ * Only the columns preceeding the barrier of the equation contribute to its
+ * mixed constraints, so changes beyond the barrier leave the residues alone.
+ */
+void Gauge::NVectorHandler::ApplyDelta(int equation, int column, int delta) {
+  if (delta == 0) return;
+  solution_->base[column] += delta;
+  if (column < touched_) touched_ = column;
+  if (column >= barriers_[equation]) return;
+  int *residues = residues_ + equation * layer_;
+  int weight = delta * amatrix_[equation][column];
+  for (int i = equation + 1; i < layer_; ++i) {
+    residues[i] += weight * amatrix_[i][column];
+  }
+}
+
 void Gauge::NVectorHandler::FillSolution() {
   int factor = multiplicity_[current_];
-  for (int i = 0; i < holders_[current_]->size; ++i) {
-    if (current_ == 0) {
-      solution_->base[factor * i] = holders_[current_]->base[i];
-    } else {
-      solution_->base[factor * i + barriers_[current_ - 1]] =
-        holders_[current_]->base[i];
-    }
+  int left = (current_ == 0) ? 0 : barriers_[current_ - 1];
+  const Gauge::NVector *holder = frames_[current_].holder;
+  for (int i = 0; i < holder->size; ++i) {
+    int column = factor * i + left;
+    ApplyDelta(current_, column, holder->base[i] - solution_->base[column]);
   }
 }
 
-bool Gauge::NVectorHandler::FindNextSolution(bool distribute) {
-  if (distribute) {
+/*!
+ * A single step makes at most one move on each of the frames it touches:
+ *  -# If the previous step left the current layer to be distributed, we
+ *     attempt to distribute it. A successful distribution in the last layer is
+ *     a solution, otherwise we push the next layer.
+ *  -# We find the next layer one solution of the current layer and fill it
+ *     into the solution. Failing that, we pop the current frame or, in layer
+ *     @c 0, report that the search is exhausted.
+ *  -# In the last layer a layer one solution is always a solution. Below it,
+ *     we push the next layer when the solution satisfies the mixed constraints
+ *     or can be distributed so that it does. Otherwise we either try the next
+ *     layer one solution (when the current one is empty) or pop the frame.
+ *
+ * Whenever we pop a frame the layer below is distributed by the next step.
+ *
+ * Layer @c 0 solutions outside of the range of the current
+ * Gauge::NVectorSlice are passed over before they are filled in, so none of
+ * the layers above them are ever entered. The first solution past the end of
+ * the range exhausts the search.
+ */
+Gauge::NVectorHandler::StepResult Gauge::NVectorHandler::Step() {
+  assert(setup_);
+  if (exhausted_) return kExhausted;
+  ++steps_;
+
+  if (distribute_) {
+    distribute_ = false;
     if (DistributeSolution()) {
+      ++frames_[current_].distributions;
       if (current_ == layer_ - 1) {
-        return true;
-      } else {
-        ++current_;
-        SetupEquation();
+        distribute_ = true;
+        ++position_;
+        return kSolution;
       }
+      Descend();
+      return kContinue;
     }
   }
 
-  if (NextLayerOneSolution()) {
-    FillSolution();
-    if (IsValid(current_) && current_ < (layer_ - 1)) {
-      ++current_;
-      SetupEquation();
-      return FindNextSolution(false);
-    } else if (current_ < layer_ - 1) {
-      if (DistributeSolution()) {
-        ++current_;
-        SetupEquation();
-        return FindNextSolution(false);
-      } else if (solvers_[current_].Sum() == 0) {
-        return FindNextSolution(false);
-      }
-      --current_;
-      return FindNextSolution(true);
+  if (!NextLayerOneSolution()) {
+    if (current_ == 0) {
+      distribute_ = true;
+      exhausted_ = true;
+      return kExhausted;
     }
-    return true;
-  } else if (current_ > 0) {
-    --current_;
-    return FindNextSolution(true);
+    PopFrame();
+    return kContinue;
   }
-  return false;
+
+  ++frames_[current_].solutions;
+  if (current_ == 0) {
+    uint64_t ordinal = frames_[0].solutions - 1;
+    if (ordinal >= end_) {
+      exhausted_ = true;
+      return kExhausted;
+    }
+    if (ordinal < begin_) return kContinue;
+  }
+  FillSolution();
+  if (current_ == layer_ - 1) {
+    distribute_ = true;
+    ++position_;
+    return kSolution;
+  }
+
+  if (IsValid(current_)) {
+    Descend();
+  } else if (DistributeSolution()) {
+    ++frames_[current_].distributions;
+    Descend();
+  } else if (solvers_[current_].Sum() != 0) {
+    PopFrame();
+  }
+  return kContinue;
+}
+
+void Gauge::NVectorHandler::PushFrame() {
+  ++current_;
+  SetupEquation();
+}
+
+void Gauge::NVectorHandler::PopFrame() {
+  --current_;
+  ++frames_[current_].backtracks;
+  distribute_ = true;
 }
 
 bool Gauge::NVectorHandler::NextLayerOneSolution() {
-  if (holders_[current_] == NULL) {
-    holders_[current_] = &solvers_[current_].Solution();
+  if (frames_[current_].holder == NULL) {
+    frames_[current_].holder = &solvers_[current_].Solution();
   }
   return solvers_[current_].NextSolution();
 }
 
-void Gauge::NVectorHandler::SetupAMatrix() {
-  if (barriers_ != NULL) delete [] barriers_;
-  if (amatrix_ != NULL) {
-    for (int index = 0; index < layer_; ++index) {
-      if (amatrix_[index] != NULL) delete [] amatrix_[index];
-    }
-    delete [] amatrix_;
-  }
-  /*!
-   * We begin by allocating the required memory to store the barriers and
-   * the amatrix.
-   */
-  barriers_ = new int[layer_];
-  amatrix_ = new int*[layer_];
+void Gauge::NVectorHandler::SetupAMatrix(const Tables &tables) {
+  /*! We begin by clearing the amatrix. */
   for (int i = 0; i < layer_; ++i) {
-    amatrix_[i] = new int[avalue_];
-    for (int j = 0; j < avalue_; ++j) amatrix_[i][j] = 0;
+    for (int j = 0; j < avalue_; ++j) tables.amatrix[i][j] = 0;
   }
   int multiplicity, replication, *coefficients, length, index;
   /*! Then, for each row we: */
@@ -641,7 +994,7 @@ void Gauge::NVectorHandler::SetupAMatrix() {
     for (int rep = 0; rep < replication - 1; ++rep) {
       for (int *coeff = coefficients; coeff != coefficients+length; ++coeff) {
         for (int mult = 0; mult < multiplicity; ++mult) {
-          amatrix_[i][index] = *coeff;
+          tables.amatrix[i][index] = *coeff;
           ++index;
         }
       }
@@ -649,18 +1002,18 @@ void Gauge::NVectorHandler::SetupAMatrix() {
     /*! - Fill the amatrix up to the next-to-last coefficient. */
     for (int *coeff = coefficients; coeff != coefficients+length-1; ++coeff) {
       for (int mult = 0; mult < multiplicity; ++mult) {
-        amatrix_[i][index] = *coeff;
+        tables.amatrix[i][index] = *coeff;
         ++index;
       }
     }
     /*! - Set the barrier for that row to the current index. */
-    barriers_[i] = index;
+    tables.barriers[i] = index;
     /*!
      * - Finally fill in the rest of the row. This coefficient will be
      *   @f$ 0 @f$, thus the setting of the barrier in the last step.
      */
     for (int mult = 0; mult < multiplicity - 1; ++mult) {
-      amatrix_[i][index] = *(coefficients + length - 1);
+      tables.amatrix[i][index] = *(coefficients + length - 1);
       ++index;
     }
     /*!
@@ -673,7 +1026,6 @@ void Gauge::NVectorHandler::SetupAMatrix() {
 
 /*!
  * In order to determine the conjugate we:
- *   -# Allocate the memory to hold the mapping.
  *   -# Initialize the array as the identity
  *      @c (Gauge::NVectorHandler::conjugates_[N] = N).
  *   -# Allocate the memory to hold an array representing the sum of columns
@@ -688,11 +1040,11 @@ void Gauge::NVectorHandler::SetupAMatrix() {
  * reduces the complexity of the algorithm from @f$ O(N^3) @f$ to
  * @f$ O(N^2) @f$.
  */
-void Gauge::NVectorHandler::SetupConjugates() {
-  if (conjugates_ != NULL) delete [] conjugates_;
+void Gauge::NVectorHandler::SetupConjugates(const Tables &tables) {
   int height = static_cast<int>(layer_ * (layer_ - 1) / 2);
-  conjugates_ = new int[avalue_];
-  for (int index = 0; index < avalue_; ++index) conjugates_[index] = index;
+  for (int index = 0; index < avalue_; ++index) {
+    tables.conjugates[index] = index;
+  }
   int *sum = new int[avalue_];
   for (int column = 0; column < avalue_; ++column) {
     sum[column] = 2;
@@ -704,9 +1056,9 @@ void Gauge::NVectorHandler::SetupConjugates() {
     }
   }
   for (int column_1 = 0; column_1 < avalue_ - 1; ++column_1) {
-    if (conjugates_[column_1] != column_1) continue;
+    if (tables.conjugates[column_1] != column_1) continue;
     for (int column_2 = column_1 + 1; column_2 < avalue_; ++column_2) {
-      if (conjugates_[column_2] != column_2) continue;
+      if (tables.conjugates[column_2] != column_2) continue;
       if (sum[column_1] == sum[column_2]) {
         int row = 0;
         for (; row < layer_; ++row) {
@@ -722,8 +1074,8 @@ void Gauge::NVectorHandler::SetupConjugates() {
             }
           }
           if (row == height) {
-            conjugates_[column_1] = column_2;
-            conjugates_[column_2] = column_1;
+            tables.conjugates[column_1] = column_2;
+            tables.conjugates[column_2] = column_1;
             break;
           }
         }
@@ -736,33 +1088,19 @@ void Gauge::NVectorHandler::SetupConjugates() {
 /*!
  * To determine the moduli we:
  *   - Determine the number of constraints: @f$ \frac{L(L+1)}{2} @f$.
- *   - Allocate enough memory to store the moduli.
  *   - Then, for each row we
  *     - Calculate the modulus
  *     - Calculate the modulus of the mixed constraints.
  *     - Initialize the coefficients of the mixed constraints.
  */
-void Gauge::NVectorHandler::SetupConstraints() {
-  if (constraints_ != NULL) delete [] constraints_;
-  if (moduli_ != NULL) delete [] moduli_;
-  int number_of_constraints = static_cast<int>(layer_ * (layer_ + 1) / 2);
-  if (number_of_constraints > layer_) {
-    constraints_ = new int*[number_of_constraints - layer_];
-    for(int row = 0; row < number_of_constraints - layer_; ++row) {
-      constraints_[row] = new int[avalue_];
-    }
-  } else {
-    constraints_ = NULL;
-  }
-
-  moduli_ = new int[number_of_constraints];
+void Gauge::NVectorHandler::SetupConstraints(const Tables &tables) {
   for (int mom = 0; mom < layer_; ++ mom) {
-    moduli_[mom] = (2 - (orders_[mom] & 1)) * orders_[mom];
+    tables.moduli[mom] = (2 - (orders_[mom] & 1)) * orders_[mom];
     for (int dad = mom + 1; dad < layer_; ++dad) {
       int index = mom + dad + layer_ - 1;
-      moduli_[index] = Gauge::Math::GCD(orders_[mom],orders_[dad]);
+      tables.moduli[index] = Gauge::Math::GCD(orders_[mom],orders_[dad]);
       for (int column = 0; column < avalue_; ++column) {
-        constraints_[index - layer_][column] =
+        tables.constraints[index - layer_][column] =
           amatrix_[mom][column] * amatrix_[dad][column];
       }
     }
@@ -770,74 +1108,312 @@ void Gauge::NVectorHandler::SetupConstraints() {
 }
 
 void Gauge::NVectorHandler::SetupEquation() {
-  /*!
-   * We first determine what the maximum size and minimum total for the equation
-   * in question.
-   */
+  int maximum_size, minimum_total;
+  SolverBounds(&maximum_size, &minimum_total);
+  solvers_[current_].Setup(orders_[current_], maximum_size, minimum_total);
+  frames_[current_].holder = NULL;
+  SetupResidues();
+}
+
+/*!
+ * We first determine what the maximum size and minimum total for the equation
+ * in question are from the columns preceeding its barrier, then reduce the
+ * minimum total to what remains up to the next multiple of the modulus.
+ */
+void Gauge::NVectorHandler::SolverBounds(int *maximum_size,
+    int *minimum_total) const {
   int left_barrier = (current_ == 0) ? 0 : barriers_[current_ - 1];
-  int maximum_size = size_;
-  int minimum_total = 0;
+  int total = 0;
   int coeff;
+  *maximum_size = size_;
   for (int i = 0; i < left_barrier; ++i) {
-    maximum_size -= solution_->base[i];
+    *maximum_size -= solution_->base[i];
     if (amatrix_[current_][i] != 0) {
       coeff = amatrix_[current_][i] * amatrix_[current_][i];
-      minimum_total += coeff * solution_->base[i];
+      total += coeff * solution_->base[i];
     }
   }
 
-  int order = orders_[current_];
   int modulus = moduli_[current_];
-  int minimum_modulus =
-    modulus * static_cast<int>(ceil(1.0 * minimum_total / modulus));
-
-  /*!
-   * Then, based on the previously initialized values, we setup the
-   * Gauge::NVectorHandler::Solver in question.
-   */
-  if (minimum_total == 0) {
-    solvers_[current_].Setup(order, maximum_size, modulus);
-  } else if (minimum_total % modulus == 0) {
-    solvers_[current_].Setup(order, maximum_size, 0);
+  if (total == 0) {
+    *minimum_total = modulus;
+  } else if (total % modulus == 0) {
+    *minimum_total = 0;
   } else {
-    solvers_[current_].Setup(order, maximum_size,
-        minimum_modulus - minimum_total);
+    *minimum_total =
+      modulus * static_cast<int>(ceil(1.0 * total / modulus)) - total;
+  }
+}
+
+/*!
+ * The residues of the current equation are computed from scratch over the
+ * columns preceeding its barrier. From here on they are kept up to date by
+ * Gauge::NVectorHandler::ApplyDelta.
+ */
+void Gauge::NVectorHandler::SetupResidues() {
+  int *residues = residues_ + current_ * layer_;
+  for (int i = current_ + 1; i < layer_; ++i) {
+    residues[i] = Residue(current_, i);
   }
-  if (holders_[current_] != NULL) holders_[current_] = NULL;
 }
 
 /*!
  * This method simply calculates the multiplicites and replications for each
  * layer.
  */
-void Gauge::NVectorHandler::SetupMultiplicities() {
-  if (multiplicity_ != NULL) delete [] multiplicity_;
-  if (replication_  != NULL) delete [] replication_;
-  multiplicity_ = new int[layer_];
-  replication_  = new int[layer_];
-
+void Gauge::NVectorHandler::SetupMultiplicities(const Tables &tables) {
   for (int l = 0; l < layer_; ++l) {
-    multiplicity_[l] = Gauge::Math::Product(orders_+l+1, orders_+layer_, 1);
-    replication_[l]  = Gauge::Math::Product(orders_, orders_+l, 1);
+    tables.multiplicity[l] =
+      Gauge::Math::Product(orders_+l+1, orders_+layer_, 1);
+    tables.replication[l]  = Gauge::Math::Product(orders_, orders_+l, 1);
+  }
+}
+
+/*!
+ * The tables depend only on the orders, so they are built once per order tuple
+ * and shared by every Gauge::NVectorHandler in the process, whatever its size.
+ * Each set of tables lives in a single allocation: the number of layers, in a
+ * slot as wide as a pointer, the row pointers of
+ * Gauge::NVectorHandler::amatrix_ and Gauge::NVectorHandler::constraints_
+ * followed by
+ *  - Gauge::NVectorHandler::orders_,
+ *  - Gauge::NVectorHandler::barriers_,
+ *  - Gauge::NVectorHandler::multiplicity_,
+ *  - Gauge::NVectorHandler::replication_,
+ *  - Gauge::NVectorHandler::moduli_,
+ *  - the rows of the a-matrix and mixed constraints, and
+ *  - Gauge::NVectorHandler::conjugates_.
+ *
+ * The first handler to see an order tuple builds its tables in place, under
+ * the lock, with the usual working methods writing through a
+ * Gauge::NVectorHandler::Tables. From then on they are read-only. The cache is
+ * keyed by a hash of the orders, so that a lookup allocates nothing; the
+ * orders stored in the tables tell apart the tuples that share a hash. A
+ * handler set up again for the orders it already has skips the lookup, and
+ * the lock, altogether.
+ *
+ * The cache lives for the whole process and is never pruned, since handlers
+ * anywhere in the process may still point into it. It holds one entry per
+ * distinct order tuple, of @f$ O(L^2 A) @f$ integers for @f$ L @f$ layers and
+ * a-value @f$ A @f$, so it grows with the number of distinct inputs the
+ * process surveys and not with the number of handlers or their Setups.
+ */
+void Gauge::NVectorHandler::SetupTables(const int *orders) {
+  static std::mutex mutex;
+  static std::unordered_multimap<uint64_t, char*> cache;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  int height = layer_ * (layer_ - 1) / 2;
+  int rows = layer_ + height;
+  int length = 4 * layer_ + layer_ * (layer_ + 1) / 2 + (rows + 1) * avalue_;
+  uint64_t key = 1469598103934665603ULL ^ layer_;
+  for (int l = 0; l < layer_; ++l) key = (key ^ orders[l]) * 1099511628211ULL;
+  char *block = NULL;
+  auto range = cache.equal_range(key);
+  for (auto entry = range.first; entry != range.second; ++entry) {
+    // The layer count leads the block, and the orders follow the row
+    // pointers, which are as many as the layer count makes.
+    const int *stored = reinterpret_cast<const int*>(
+        reinterpret_cast<int**>(entry->second) + 1 + rows);
+    if (*reinterpret_cast<const int*>(entry->second) == layer_ &&
+        std::equal(orders, orders + layer_, stored)) {
+      block = entry->second;
+      break;
+    }
+  }
+  bool build = (block == NULL);
+  if (build) {
+    block = new char[(1 + rows) * sizeof(int*) + length * sizeof(int)];
+    *reinterpret_cast<int*>(block) = layer_;
+    cache.insert(std::make_pair(key, block));
+  }
+
+  Tables tables;
+  tables.amatrix = reinterpret_cast<int**>(block) + 1;
+  tables.constraints = (height > 0) ? tables.amatrix + layer_ : NULL;
+  int *data = reinterpret_cast<int*>(tables.amatrix + rows);
+  tables.orders = data;
+  tables.barriers = tables.orders + layer_;
+  tables.multiplicity = tables.barriers + layer_;
+  tables.replication = tables.multiplicity + layer_;
+  tables.moduli = tables.replication + layer_;
+  data = tables.moduli + layer_ * (layer_ + 1) / 2;
+  tables.conjugates = (layer_ != 1) ? data + rows * avalue_ : NULL;
+  amatrix_ = tables.amatrix;
+  barriers_ = tables.barriers;
+  conjugates_ = tables.conjugates;
+  constraints_ = tables.constraints;
+  moduli_ = tables.moduli;
+  multiplicity_ = tables.multiplicity;
+  orders_ = tables.orders;
+  replication_ = tables.replication;
+  if (!build) return;
+
+  for (int row = 0; row < rows; ++row) {
+    tables.amatrix[row] = data + row * avalue_;
+  }
+  for (int l = 0; l < layer_; ++l) tables.orders[l] = orders[l];
+  SetupMultiplicities(tables);  // The multiplicity and replication arrays.
+  SetupAMatrix(tables);         // The a-matrix and barriers.
+  SetupConstraints(tables);     // The moduli and mixed constraints.
+  if (layer_ != 1) {
+    SetupConjugates(tables);    // Determine which n-values are conjugates.
+    CheckConjugates();          // Conjugates must share a segment.
   }
 }
 
 /*!
- * We allocate the memory for the Gauge::NVectorHandler::holders_ and
+ * We allocate the memory for the Gauge::NVectorHandler::frames_ and
  * Gauge::NVectorHandler::solvers_, one for each layer.
  *
- * We then initialize each of the Gauge::NVectorHandler::holders_ to
- * a pointer to the internal solution state of the corresponding
- * Gauge::NVectorHandler::Solver.
+ * We then initialize each of the Gauge::NVectorHandler::frames_ with an empty
+ * holder and zeroed counters. The holders are later pointed at the internal
+ * solution state of the corresponding Gauge::NVectorHandler::Solver. The
+ * Gauge::NVectorHandler::residues_ are allocated alongside, one row per layer.
  */
 void Gauge::NVectorHandler::SetupSolvers() {
-  if (holders_ != NULL) delete [] holders_;
+  if (container_ != NULL) delete [] container_;
+  if (frames_ != NULL) delete [] frames_;
+  if (partners_ != NULL) delete [] partners_;
+  if (residues_ != NULL) delete [] residues_;
   if (solvers_  != NULL) delete [] solvers_;
-  holders_ = new const Gauge::NVector*[layer_];
+  container_ = new int[2 * multiplicity_[0]];
+  partners_ = new int[2 * multiplicity_[0]];
+  frames_ = new Gauge::NVectorHandler::Frame[layer_];
+  residues_ = new int[layer_ * layer_];
+  for (int i = 0; i < layer_ * layer_; ++i) residues_[i] = 0;
   solvers_ = new Gauge::NVectorHandler::Solver[layer_];
   for (int l = 0; l < layer_; ++l) {
-    holders_[l] = NULL;
+    frames_[l].holder = NULL;
+    frames_[l].solutions = 0;
+    frames_[l].distributions = 0;
+    frames_[l].backtracks = 0;
+  }
+}
+
+/*!
+ * In counting mode the layer below the last is never left: we tally the
+ * Gauge::NVectors the last layer would produce and distribute the current layer
+ * again, exactly as if the last frame had been pushed and then exhausted. A
+ * skip stops counting at the batch holding the Gauge::NVector it moves to, and
+ * enters that one.
+ */
+bool Gauge::NVectorHandler::Descend() {
+  if (!counting_ || current_ != layer_ - 2) {
+    PushFrame();
+    return true;
+  }
+  ++current_;
+  uint64_t count = CountLastLayer();
+  if (tally_ + count > skip_) {
+    --current_;
+    counting_ = false;
+    PushFrame();
+    return true;
+  }
+  tally_ += count;
+  PopFrame();
+  return false;
+}
+
+/*!
+ * The walk leaves the search exactly where producing the skipped
+ * Gauge::NVectors would have, except for the first changed column, which is
+ * reset so that the next Gauge::NVector reports every column as changed.
+ */
+void Gauge::NVectorHandler::Skip(uint64_t count) {
+  if (count == 0) return;
+  StepResult result = kContinue;
+  tally_ = 0;
+  if (layer_ > 1) {
+    counting_ = true;
+    skip_ = count;
+    while (counting_ && (result = Step()) != kExhausted) continue;
+    counting_ = false;
+    skip_ = UINT64_MAX;
+  }
+  while (result != kExhausted && tally_ < count) {
+    result = Step();
+    if (result == kSolution) ++tally_;
+  }
+  position_ = tally_;
+  tally_ = 0;
+  touched_ = 0;
+}
+
+/*!
+ * The last layer has no mixed constraints of its own and its conjugate pairs
+ * never leave a segment, so every layer one solution @f$ y @f$ is produced
+ * once filled and then once for every distribution of each of its segments
+ * that keeps the pair in conjugate order. When the layers below are out of
+ * conjugate order no distribution passes, leaving the fill alone.
+ *
+ * The result only depends on the arguments of the
+ * Gauge::NVectorHandler::Solver and the conjugate order below, so it is
+ * memoized in Gauge::NVectorHandler::tallies_.
+ */
+uint64_t Gauge::NVectorHandler::CountLastLayer() {
+  int maximum_size, minimum_total;
+  SolverBounds(&maximum_size, &minimum_total);
+  int left = barriers_[current_ - 1];
+  bool ordered = true;
+  for (int i = 0; i < left; ++i) {
+    if (conjugates_[i] > i &&
+        solution_->base[i] < solution_->base[conjugates_[i]]) {
+      ordered = false;
+      break;
+    }
+  }
+  int key = ((ordered ? 1 : 0) * (size_ + 1) + maximum_size) * 1024 +
+    minimum_total;
+  std::map<int,uint64_t>::const_iterator found = tallies_.find(key);
+  if (found != tallies_.end()) return found->second;
+
+  int order = orders_[current_];
+  int midpoint = left + order/2;
+  Solver solver;
+  solver.Setup(order, maximum_size, minimum_total);
+  uint64_t count = 0;
+  while (solver.NextSolution()) {
+    const Gauge::NVector &holder = solver.Solution();
+    uint64_t product = 1;
+    for (int segment = 0; ordered && segment < holder.size; ++segment) {
+      if ((order & 1) == 0 && segment == 0) continue;
+      int start = left + segment;
+      int start2 = midpoint + segment - (((order & 1) == 0) ? 1 : 0);
+      int value = holder.base[segment];
+      product *= (conjugates_[start] == start2) ? value/2 + 1 : value + 1;
+    }
+    count += product;
+  }
+  tallies_[key] = count;
+  return count;
+}
+
+/*!
+ * The walk runs on a scratch Gauge::NVectorHandler with the same Setup and
+ * range. Its last layer is tallied by Gauge::NVectorHandler::Descend, except
+ * with a single layer where every step that finds a solution counts one.
+ */
+uint64_t Gauge::NVectorHandler::CountRange(uint64_t begin, uint64_t end,
+    std::vector<uint64_t> *weights) const {
+  Gauge::NVectorHandler walk;
+  walk.Setup(orders_, layer_, size_);
+  walk.begin_ = begin;
+  walk.end_ = end;
+  walk.counting_ = true;
+  uint64_t last = 0;
+  StepResult result;
+  while ((result = walk.Step()) != kExhausted) {
+    if (result == kSolution) ++walk.tally_;
+    if (weights != NULL && walk.tally_ != last) {
+      uint64_t ordinal = walk.frames_[0].solutions - 1;
+      if (weights->size() <= ordinal) weights->resize(ordinal + 1, 0);
+      (*weights)[ordinal] += walk.tally_ - last;
+      last = walk.tally_;
+    }
   }
+  return walk.tally_;
 }
 
 void Gauge::NVectorHandler::Coefficients(int layer, int **coeff, int *length) {
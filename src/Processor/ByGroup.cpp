@@ -52,10 +52,14 @@ void Gauge::Process::ByGroup::Process(const Gauge::Model &model) {
   if (files.find(group) == end(files) || files[group] == NULL)
     files[group] = new std::ofstream(local + group + ".txt");
 
-  if (print_gso)
-    *files[group] << *model.geometry << std::endl;
-  else
-    *files[group] << model.geometry->basis << std::endl;
+  // A representative is written once for each member of its class, as the
+  // systematic enumeration would have written them.
+  for (uint64_t copy = 0; copy < model.geometry->multiplicity; ++copy) {
+    if (print_gso)
+      *files[group] << *model.geometry << std::endl;
+    else
+      *files[group] << model.geometry->basis << std::endl;
+  }
 }
 
 void Gauge::Process::ByGroup::Finalize() {
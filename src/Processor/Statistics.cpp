@@ -32,20 +32,21 @@
 void Gauge::Process::Statistics::Process(const Gauge::Model &model) {
   assert(!finalized);
   int susy = model.susy;
+  uint64_t count = model.geometry->multiplicity;
   std::string order = OrderString(model);
   std::string group = GroupString(model);
 
   if (stats.find(susy) != stats.end()) {
     if (stats[susy].find(order) != stats[susy].end())
       if (stats[susy][order].find(group) != stats[susy][order].end())
-        stats[susy][order][group] += 1;
+        stats[susy][order][group] += count;
       else
-        stats[susy][order][group] = 1;
+        stats[susy][order][group] = count;
     else
-      stats[susy][order].insert(GroupEntry(group,1));
+      stats[susy][order].insert(GroupEntry(group,count));
   } else {
     stats[susy].insert(OrderEntry(order, GroupMap()));
-    stats[susy][order].insert(GroupEntry(group,1));
+    stats[susy][order].insert(GroupEntry(group,count));
   }
 }
 
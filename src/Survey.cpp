@@ -1,22 +1,595 @@
 #include <inttypes.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Datatypes/WorkUnit.h>
 #include <GeometryFactory.h>
 #include <Logger.h>
 #include <ModelFactory.h>
 #include <MPI.h>
+#include <NVectorCatalog.h>
+#include <NVectorHandler.h>
+#include <Utility/Directory.h>
+#include <Utility/Queue.h>
 
 #include <Survey.h>
 
-void Gauge::Survey::Parallel(
+namespace {
+  /*!
+   * A Gauge::Geometry joins the batch being collected when the batch is not
+   * full and the geometry has the same Gauge::Basis, so that the massless
+   * states of the basis are found and projected only once.
+   */
+  bool JoinsBatch(const std::vector<Gauge::Geometry> &batch,
+                  const Gauge::Geometry &geometry) {
+    return batch.empty() ||
+      (batch.size() < Gauge::ModelFactory::kBatch &&
+       batch[0].basis == geometry.basis &&
+       batch[0].gso_matrix.size == geometry.gso_matrix.size);
+  }
+
+  /*!
+   * A UnitSizer keeps a running estimate of the seconds a range of ordinals
+   * takes per ordinal, and sizes the ranges to take about kBatchSeconds
+   * each, so that cheap geometries are not latency-bound and expensive ones
+   * are still shared out evenly. Until the first estimate, a range is as
+   * large as a shared basis.
+   */
+  class UnitSizer {
+    public:
+      UnitSizer() : seconds_(0.0), size_(Gauge::ModelFactory::kBatch) {}
+      /*!
+       * This method folds the seconds per ordinal of a range into the
+       * estimate.
+       */
+      void Update(double seconds) {
+        seconds_ = (seconds_ == 0.0) ? seconds :
+          0.8 * seconds_ + 0.2 * seconds;
+        if (seconds_ > 0.0 && kBatchSeconds / seconds_ < kLargestBatch)
+          size_ = std::max<uint64_t>(1, kBatchSeconds / seconds_);
+        else if (seconds_ > 0.0)
+          size_ = kLargestBatch;
+      }
+      /*!
+       * @return The number of ordinals of the next range.
+       */
+      uint64_t size() const { return size_; }
+
+    private:
+      static constexpr double kBatchSeconds = 0.05;
+      static const uint64_t kLargestBatch = 1 << 14;
+
+      double seconds_;  /*!< The estimated seconds per ordinal. */
+      uint64_t size_;   /*!< The size of the next range. */
+  };
+
+  /*!
+   * This function builds the models of a batch of geometries sharing their
+   * Gauge::Basis, and passes them to the processors.
+   *
+   * @return The number of models built, each counted as many times as the
+   * Gauge::Geometry::multiplicity of its Gauge::Geometry.
+   */
+  uint64_t BuildBatch(Gauge::ModelFactory *builder,
+                      const std::vector<Gauge::Geometry> &batch,
+                      Gauge::ProcessorList *processors) {
+    if (batch.empty()) return 0;
+    std::vector<const Gauge::Geometry*> geometries;
+    for (size_t index = 0; index < batch.size(); ++index)
+      geometries.push_back(&batch[index]);
+    builder->Setup(geometries.data(), geometries.size());
+    uint64_t count = 0;
+    for (size_t index = 0; index < batch.size(); ++index) {
+      if (!builder->Build(index)) break;
+      count += batch[index].multiplicity;
+      processors->Process(builder->Model());
+    }
+    return count;
+  }
+
+  /*!
+   * A BuilderPool runs builder threads over batches of geometries sharing a
+   * Gauge::Basis, which it collects from the geometries added to it and hands
+   * over through a bounded Utility::Queue. Each builder has its own
+   * Gauge::ModelFactory and local copy of the processors, which are merged
+   * into the processors of the pool once it is finished. The queue is pushed
+   * and popped without locking; the mutex is only taken to sleep on a full or
+   * empty queue, and by the other side before it wakes the sleeper.
+   */
+  class BuilderPool {
+    public:
+      /*!
+       * The constructor starts the builders.
+       *
+       * @param[in] processors The processors into which to merge.
+       * @param[in] threads The number of builders, or @c 0 for one per
+       * hardware thread.
+       */
+      BuilderPool(Gauge::ProcessorList *processors, int threads)
+        : batch_(NULL), count_(0), built_(0), busy_(0),
+          processors_(processors), produced_(false),
+          queue_(Capacity(Threads(threads))) {
+        threads = Threads(threads);
+        for (int thread = 0; thread < threads; ++thread)
+          locals_.push_back(processors->LocalList());
+        for (int thread = 0; thread < threads; ++thread)
+          builders_.emplace_back(&BuilderPool::Run, this, locals_[thread]);
+        NewBatch();
+      }
+      /*!
+       * This method adds a geometry to the batch being collected, handing the
+       * batch to the builders first if the geometry does not join it.
+       *
+       * @param[in] geometry The geometry to build.
+       */
+      void Add(const Gauge::Geometry &geometry) {
+        if (!JoinsBatch(*batch_, geometry)) Flush();
+        batch_->push_back(geometry);
+      }
+      /*!
+       * @return The number of models built so far.
+       */
+      uint64_t count() const { return count_.load(); }
+      /*!
+       * @return The number of geometries built so far.
+       */
+      uint64_t built() const { return built_.load(); }
+      /*!
+       * @return The seconds the builders have spent building so far, summed
+       * over the builders.
+       */
+      double busy() const { return busy_.load() * 1e-9; }
+      /*!
+       * @return The number of builders.
+       */
+      int threads() const { return builders_.size(); }
+      /*!
+       * This method builds the geometries still held, stops the builders and
+       * merges their processors.
+       *
+       * @return The number of models built.
+       */
+      uint64_t Finish() {
+        if (!batch_->empty()) Flush();
+        delete batch_;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          produced_ = true;
+        }
+        ready_.notify_all();
+        for (auto &builder: builders_) builder.join();
+        for (auto *local: locals_) {
+          processors_->Merge(*local);
+          delete local;
+        }
+        return count_.load();
+      }
+      /*!
+       * @return The number of builders for a request of @c threads.
+       */
+      static int Threads(int threads) {
+        if (threads <= 0) threads = std::thread::hardware_concurrency();
+        return (threads <= 0) ? 1 : threads;
+      }
+
+    private:
+      // A few batches per builder keep them busy while the producer catches
+      // up.
+      static size_t Capacity(int threads) {
+        size_t capacity = 2;
+        while (capacity < 4 * static_cast<size_t>(threads)) capacity *= 2;
+        return capacity;
+      }
+      void Flush() {
+        if (!queue_.Push(batch_)) {
+          std::unique_lock<std::mutex> lock(mutex_);
+          space_.wait(lock, [this] { return queue_.Push(batch_); });
+        }
+        Wake(&ready_);
+        NewBatch();
+      }
+      void NewBatch() {
+        batch_ = new std::vector<Gauge::Geometry>();
+        batch_->reserve(Gauge::ModelFactory::kBatch);
+      }
+      void Run(Gauge::ProcessorList *local) {
+        Gauge::ModelFactory builder;
+        std::vector<Gauge::Geometry> *batch;
+        for (;;) {
+          if (!queue_.Pop(&batch)) {
+            // The flag is only set once every batch has been pushed.
+            bool popped = false;
+            std::unique_lock<std::mutex> lock(mutex_);
+            ready_.wait(lock, [&] {
+              popped = queue_.Pop(&batch);
+              return popped || produced_;
+            });
+            if (!popped) break;
+          }
+          Wake(&space_);
+          auto start = std::chrono::steady_clock::now();
+          count_ += BuildBatch(&builder, *batch, local);
+          // The time goes in first, so that it covers every geometry counted.
+          busy_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - start).count();
+          built_ += batch->size();
+          delete batch;
+        }
+      }
+      // Taking the mutex first means a thread about to sleep either sees the
+      // change or is already waiting when notified.
+      void Wake(std::condition_variable *condition) {
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        condition->notify_one();
+      }
+
+      std::vector<Gauge::Geometry> *batch_;  /*!< The batch being collected. */
+      std::vector<std::thread> builders_;    /*!< The builder threads. */
+      std::atomic<uint64_t> count_;          /*!< The models built. */
+      std::atomic<uint64_t> built_;          /*!< The geometries built. */
+      std::atomic<uint64_t> busy_;           /*!< The nanoseconds spent
+                                               building. */
+      std::vector<Gauge::ProcessorList*> locals_; /*!< The processors of the
+                                                    builders. */
+      std::mutex mutex_;                     /*!< Guards sleeping on the
+                                               queue. */
+      Gauge::ProcessorList *processors_;     /*!< The merged processors. */
+      bool produced_;                        /*!< Whether every batch has
+                                               been handed over, guarded by
+                                               the mutex. */
+      Utility::Queue<std::vector<Gauge::Geometry>*> queue_; /*!< The batches
+                                                              handed over. */
+      std::condition_variable ready_;        /*!< Signalled when a batch is
+                                               handed over. */
+      std::condition_variable space_;        /*!< Signalled when a batch is
+                                               taken. */
+  };
+
+  /*!
+   * A UnitReader walks the geometries of the Gauge::WorkUnit instances dealt
+   * to a builder, which come in increasing order and mostly back to back,
+   * with the builder's own Gauge::GeometryFactory. The factory may be left
+   * holding a geometry past the end of a unit, which belongs to a later one.
+   */
+  class UnitReader {
+    public:
+      explicit UnitReader(Gauge::GeometryFactory *factory)
+        : current_(false), exhausted_(false), factory_(factory) {}
+      /*!
+       * This method passes each geometry of a unit to @c use.
+       */
+      template <class Use>
+      void Read(const Gauge::WorkUnit &unit, Use use) {
+        if (!exhausted_ && (!current_ || factory_->Position() < unit.begin)) {
+          factory_->Seek(unit.begin);
+          Advance();
+        }
+        while (current_ && factory_->Position() < unit.end) {
+          use(*factory_->Geometry());
+          Advance();
+        }
+      }
+
+      /*!
+       * @return Whether the factory has run out, or its ordinals overflowed,
+       * so that no later unit holds a geometry.
+       */
+      bool exhausted() const { return exhausted_; }
+
+    private:
+      void Advance() {
+        current_ = factory_->NextGeometry();
+        exhausted_ = !current_ || factory_->Overflow();
+      }
+
+      bool current_;    /*!< Whether the factory holds a geometry not yet
+                          read. */
+      bool exhausted_;  /*!< Whether the factory has run out. */
+      Gauge::GeometryFactory *factory_; /*!< The factory read. */
+  };
+
+  /*!
+   * The builders pull their work. The root counts the ordinals with its own
+   * Gauge::GeometryFactory, an input at a time, and keeps a contiguous run of
+   * them for each builder. It deals each builder a window of Gauge::WorkUnit
+   * ranges from the front of its run to start with and, whenever one of them
+   * reports a unit done, sends it the next one, so no builder waits on
+   * another. A builder whose run is used up takes the back half of the
+   * largest run left ahead of it, or the whole of the next input when none
+   * is left.
+   * A unit is a pair of ordinals, and every builder rebuilds the geometries
+   * of its units with its own Gauge::GeometryFactory. Its units follow one
+   * another, so it only seeks where it has taken over a run, and never
+   * constructs the bases of the others; the root never produces or
+   * serializes a Gauge::Geometry.
+   *
+   * The builders report how long each ordinal of a unit took, from which the
+   * root sizes the units with a UnitSizer. A builder with a BuilderPool
+   * reports the time its threads take to build the unit, from their
+   * measured rate, when that is longer than reading it.
+   *
+   * A builder with @c threads of @c 0 builds on its own thread; otherwise it
+   * hands its geometries to a BuilderPool, whose processors are merged before
+   * they are sent to the root.
+   */
+  void Pull(int &argc, char **argv,
+            Gauge::ProcessorList &processors,
+            Gauge::GeometryFactory *geometry_factory,
+            Gauge::InputFactory::Generic *inputs,
+            std::string log_file,
+            int window, int threads) {
+
+    using namespace Gauge;
+
+    const int good_tag = 73, exit_tag = 81, request_tag = 97, root = 0;
+
+    // Only the thread that initialized MPI makes MPI calls.
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    int rank, num_procs;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_procs);
+
+    assert(1 < num_procs && 0 < window);
+
+    geometry_factory->Setup(inputs);
+
+    // A report holds the seconds per ordinal of a unit and the number of
+    // models built since the last report. The models a builder has not
+    // reported by the end are summed up after. The reports and the units are
+    // sent without blocking, from two buffers and a slot per unit of the
+    // window of a builder, each waited on before it is reused.
+    double report[2][2];
+    MPI_Request reporting[2] = { MPI_REQUEST_NULL, MPI_REQUEST_NULL };
+    uint64_t unreported = 0, total = 0;
+
+    if (rank == root) {
+      Gauge::Logger logger(log_file);
+      logger.Log(std::to_string(num_procs) + " processes started.");
+      if (threads == 0)
+        logger.Log(std::to_string(num_procs-1) + " builders started.");
+      else
+        logger.Log(std::to_string(num_procs-1) + " builders started with " +
+                   std::to_string(threads) + " threads each.");
+      uint64_t count = 0;
+
+      // The run of a builder is [next, end); next is also one past the last
+      // ordinal dealt to it.
+      std::vector<uint64_t> next(num_procs, 0), end(num_procs, 0);
+
+      int outstanding = 0;
+
+      std::vector<Gauge::Raw *> units(num_procs * window, NULL);
+      std::vector<MPI_Request> sending(num_procs * window, MPI_REQUEST_NULL);
+      std::vector<int> slots(num_procs, 0);
+
+      UnitSizer sizer;
+
+      // Only the ordinals past everything dealt to the builder may be taken,
+      // since its factory only moves forward.
+      auto take = [&](int process) {
+        int victim = root;
+        uint64_t largest = 0;
+        for (int other = 0; other < num_procs; ++other) {
+          uint64_t first = std::max(next[other], next[process]);
+          if (other == root || end[other] <= first) continue;
+          if (end[other] - first > largest) {
+            largest = end[other] - first;
+            victim = other;
+          }
+        }
+        if (victim == root) return false;
+        uint64_t first = std::max(next[victim], next[process]);
+        next[process] = first + (end[victim] - first) / 2;
+        end[process] = end[victim];
+        end[victim] = next[process];
+        return true;
+      };
+
+      // The ordinals are counted an input at a time, once everything before
+      // them is dealt: the builder that runs out first is given the whole
+      // input, which the others then take from.
+      auto extend = [&](int process) {
+        uint64_t first = geometry_factory->Position();
+        while (geometry_factory->SkipInput()) {
+          if (geometry_factory->Position() == first) continue;
+          next[process] = first;
+          end[process] = geometry_factory->Position();
+          return true;
+        }
+        return false;
+      };
+
+      auto serve = [&](int process) {
+        if (next[process] == end[process] && !take(process) &&
+            !extend(process))
+          return;
+        uint64_t stop = std::min(next[process] + sizer.size(), end[process]);
+        int slot = process * window + slots[process];
+        slots[process] = (slots[process] + 1) % window;
+        MPI_Wait(&sending[slot], MPI_STATUS_IGNORE);
+        delete units[slot];
+        units[slot] = Gauge::MPI::Send(Gauge::WorkUnit(next[process], stop),
+                                       process, good_tag, &sending[slot]);
+        next[process] = stop;
+        ++outstanding;
+      };
+
+      for (int slot = 0; slot < window; ++slot)
+        for (int process = 0; process < num_procs; ++process)
+          if (process != root) serve(process);
+
+      while (outstanding > 0) {
+        MPI_Status status;
+        MPI_Recv(report[0], 2, MPI_DOUBLE, MPI_ANY_SOURCE, request_tag,
+                 MPI_COMM_WORLD, &status);
+        --outstanding;
+
+        uint64_t built = report[0][1];
+        if (count / 1000000 != (count + built) / 1000000)
+          logger.Log(std::to_string(count + built) + " models built");
+        count += built;
+
+        sizer.Update(report[0][0]);
+
+        serve(status.MPI_SOURCE);
+      }
+
+      MPI_Waitall(sending.size(), sending.data(), MPI_STATUSES_IGNORE);
+      for (Gauge::Raw *unit : units) delete unit;
+
+      for (int process = 0; process < num_procs; ++process)
+        if (process != root) {
+          Gauge::MPI::SendTag(process, exit_tag);
+          Gauge::ProcessorList *local = processors.LocalList();
+          Gauge::MPI::Receive(process, exit_tag, local);
+          processors.Merge(*local);
+          delete local;
+        }
+
+      processors.Finalize();
+
+      if (geometry_factory->Overflow())
+        logger.Log("Error: the ordinals outgrew 64 bits; the inputs from "
+                   "there on were not surveyed.");
+
+      MPI_Reduce(&unreported, &total, 1, MPI_UINT64_T, MPI_SUM, root,
+                 MPI_COMM_WORLD);
+      logger.Log("Models Constructed: " + std::to_string(count + total));
+    } else {
+      ModelFactory *factory = NULL;
+      BuilderPool *pool = NULL;
+      if (threads == 0)
+        factory = new ModelFactory();
+      else
+        pool = new BuilderPool(&processors, threads);
+
+      UnitReader reader(geometry_factory);
+      Gauge::WorkUnit unit;
+      std::vector<Gauge::Geometry> run;
+      run.reserve(ModelFactory::kBatch);
+      uint64_t built = 0, reported = 0;
+      int slot = 0;
+
+      // The pool builds behind the reader, so the time to read a unit says
+      // little about the time to build it. A unit is taken to last as long as
+      // the slower of the two, building at the pool's rate over the
+      // geometries it built since the last report in which it moved.
+      uint64_t measured = 0;
+      double spent = 0.0;
+
+      while (Gauge::MPI::Receive(root, exit_tag, &unit)) {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t read = 0;
+        if (pool != NULL) {
+          reader.Read(unit, [&](const Gauge::Geometry &geometry) {
+            pool->Add(geometry);
+            ++read;
+          });
+          built = pool->count();
+        } else {
+          reader.Read(unit, [&](const Gauge::Geometry &geometry) {
+            if (!JoinsBatch(run, geometry)) {
+              built += BuildBatch(factory, run, &processors);
+              run.clear();
+            }
+            run.push_back(geometry);
+          });
+          built += BuildBatch(factory, run, &processors);
+          run.clear();
+        }
+        std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+        double seconds = elapsed.count();
+        uint64_t geometries = (pool != NULL) ? pool->built() : 0;
+        if (geometries > measured) {
+          double busy = pool->busy();
+          seconds = std::max(seconds, (busy - spent) / pool->threads() /
+                                      (geometries - measured) * read);
+          spent = busy;
+          measured = geometries;
+        }
+
+        MPI_Wait(&reporting[slot], MPI_STATUS_IGNORE);
+        report[slot][0] = seconds / (unit.end - unit.begin);
+        report[slot][1] = built - reported;
+        reported = built;
+        MPI_Isend(report[slot], 2, MPI_DOUBLE, root, request_tag,
+                  MPI_COMM_WORLD, &reporting[slot]);
+        slot = 1 - slot;
+      }
+      MPI_Waitall(2, reporting, MPI_STATUSES_IGNORE);
+
+      if (pool != NULL) {
+        built = pool->Finish();
+        delete pool;
+      } else {
+        delete factory;
+      }
+      unreported = built - reported;
+
+      Gauge::MPI::Send(processors, root, good_tag);
+      MPI_Reduce(&unreported, &total, 1, MPI_UINT64_T, MPI_SUM, root,
+                 MPI_COMM_WORLD);
+    }
+
+    delete geometry_factory;
+
+    MPI_Finalize();
+  }
+}
+
+/*!
+ * A catalog already in the directory is kept as long as it opens, that is as
+ * long as it was written for the same orders and size; anything else is
+ * exported again.
+ */
+void Gauge::Survey::Catalog(
+    Gauge::InputFactory::Generic *inputs,
+    std::string directory) {
+  Utility::Dir::Create(directory);
+  Gauge::NVectorCatalog::SetDirectory(directory);
+
+  Gauge::NVectorCatalog catalog;
+  while (inputs->Next()) {
+    const Gauge::Input &input = inputs->Input();
+    int size = 26 - input.dimensions;
+    std::string path =
+      Gauge::NVectorCatalog::Path(input.orders, input.layers, size);
+    if (catalog.Open(path, input.orders, input.layers, size)) continue;
+    Gauge::NVectorHandler handler;
+    handler.Setup(input.orders, input.layers, size);
+    handler.Export(path);
+  }
+  catalog.Close();
+
+  delete inputs;
+}
+
+/*!
+ * The root exposes the first ordinal not yet taken as a counter in a window
+ * of one-sided memory, and takes no other part until it merges the
+ * processors. Every builder runs its own Gauge::GeometryFactory and pulls
+ * contiguous ranges of ordinals off the counter with an atomic fetch and add,
+ * sized by its own UnitSizer, until its factory runs out past them. The
+ * counter only grows, so the ranges of a builder come in increasing order
+ * and, read with a UnitReader, each Gauge::Geometry is built by exactly one
+ * builder without any being sent, and no builder constructs the bases of the
+ * others. Nothing is counted ahead of time.
+ */
+void Gauge::Survey::Decentralized(
     int &argc, char **argv,
     Gauge::ProcessorList &&processors,
     Gauge::GeometryFactory *geometry_factory,
     Gauge::InputFactory::Generic *inputs,
     std::string log_file) {
 
-  using namespace Gauge;
-  using namespace Gauge::InputFactory;
-
   const int good_tag = 73, exit_tag = 81, root = 0;
 
   MPI_Init(&argc, &argv);
@@ -26,28 +599,21 @@ void Gauge::Survey::Parallel(
 
   assert(1 < num_procs);
 
+  geometry_factory->Setup(inputs);
+  uint64_t count = 0, total = 0, counter = 0;
+  int overflow = 0, overflows = 0;
+
+  MPI_Win window;
+  MPI_Win_create(&counter, (rank == root) ? sizeof(counter) : 0,
+                 sizeof(counter), MPI_INFO_NULL, MPI_COMM_WORLD, &window);
+
   if (rank == root) {
     Gauge::Logger logger(log_file);
     logger.Log(std::to_string(num_procs) + " processes started.");
     logger.Log(std::to_string(num_procs-1) + " builders started.");
-    uint64_t count = 0;
-
-    geometry_factory->Setup(inputs);
-    int process = 2;
-    while (geometry_factory->NextGeometry()) {
-      Gauge::MPI::Send(*geometry_factory->Geometry(), process, good_tag);
-
-      if (count % 1000000 == 0)
-        logger.Log(std::to_string(count + 1) + " geometries built");
-      ++count;
 
-      process = (process + 1) % (num_procs - 1) + 1;
-    }
-    delete geometry_factory;
-
-    for (process = 0; process < num_procs; ++process)
+    for (int process = 0; process < num_procs; ++process)
       if (process != root) {
-        Gauge::MPI::SendTag(process, exit_tag);
         Gauge::ProcessorList *local = processors.LocalList();
         Gauge::MPI::Receive(process, exit_tag, local);
         processors.Merge(*local);
@@ -56,24 +622,84 @@ void Gauge::Survey::Parallel(
 
     processors.Finalize();
 
-    logger.Log("Models Constructed: " + std::to_string(count));
+    MPI_Reduce(&overflow, &overflows, 1, MPI_INT, MPI_LOR, root,
+               MPI_COMM_WORLD);
+    if (overflows)
+      logger.Log("Error: the ordinals outgrew 64 bits; the inputs from "
+                 "there on were not surveyed.");
+
+    MPI_Reduce(&count, &total, 1, MPI_UINT64_T, MPI_SUM, root,
+               MPI_COMM_WORLD);
+    logger.Log("Models Constructed: " + std::to_string(total));
   } else {
-    ModelFactory *factory = new ModelFactory();
-    Gauge::Geometry geometry;
-    while (Gauge::MPI::Receive(root, exit_tag, &geometry)) {
-      factory->Setup(&geometry);
-      if (factory->Build())
-        processors.Process(factory->Model());
+    ModelFactory *builder = new ModelFactory();
+    UnitReader reader(geometry_factory);
+    UnitSizer sizer;
+
+    std::vector<Gauge::Geometry> batch;
+    batch.reserve(ModelFactory::kBatch);
+    while (!reader.exhausted()) {
+      uint64_t size = sizer.size(), begin;
+      MPI_Win_lock(MPI_LOCK_SHARED, root, 0, window);
+      MPI_Fetch_and_op(&size, &begin, MPI_UINT64_T, root, 0, MPI_SUM,
+                       window);
+      MPI_Win_unlock(root, window);
+      uint64_t end = (begin > UINT64_MAX - size) ? UINT64_MAX : begin + size;
+
+      auto start = std::chrono::steady_clock::now();
+      reader.Read(Gauge::WorkUnit(begin, end),
+                  [&](const Gauge::Geometry &geometry) {
+        if (!JoinsBatch(batch, geometry)) {
+          count += BuildBatch(builder, batch, &processors);
+          batch.clear();
+        }
+        batch.push_back(geometry);
+      });
+      count += BuildBatch(builder, batch, &processors);
+      batch.clear();
+      std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+      sizer.Update(elapsed.count() / size);
     }
+    overflow = geometry_factory->Overflow();
 
     Gauge::MPI::Send(processors, root, good_tag);
+    MPI_Reduce(&overflow, &overflows, 1, MPI_INT, MPI_LOR, root,
+               MPI_COMM_WORLD);
+    MPI_Reduce(&count, &total, 1, MPI_UINT64_T, MPI_SUM, root,
+               MPI_COMM_WORLD);
 
-    delete factory;
+    delete builder;
   }
 
+  MPI_Win_free(&window);
+  delete geometry_factory;
+
   MPI_Finalize();
 }
 
+void Gauge::Survey::Hybrid(
+    int &argc, char **argv,
+    Gauge::ProcessorList &&processors,
+    Gauge::GeometryFactory *geometry_factory,
+    Gauge::InputFactory::Generic *inputs,
+    std::string log_file,
+    int threads,
+    int window) {
+  Pull(argc, argv, processors, geometry_factory, inputs, log_file, window,
+       BuilderPool::Threads(threads));
+}
+
+void Gauge::Survey::Parallel(
+    int &argc, char **argv,
+    Gauge::ProcessorList &&processors,
+    Gauge::GeometryFactory *geometry_factory,
+    Gauge::InputFactory::Generic *inputs,
+    std::string log_file,
+    int window) {
+  Pull(argc, argv, processors, geometry_factory, inputs, log_file, window, 0);
+}
+
 void Gauge::Survey::Serial(
     Gauge::ProcessorList &&processors,
     Gauge::GeometryFactory *geometry_factory,
@@ -89,15 +715,24 @@ void Gauge::Survey::Serial(
 
   uint64_t count = 0;
 
+  // Consecutive geometries that share a basis are built as one batch, so the
+  // massless states of the basis are found and projected only once.
+  std::vector<Gauge::Geometry> batch;
+  batch.reserve(ModelFactory::kBatch);
+  auto flush = [&]() {
+    uint64_t built = BuildBatch(builder, batch, &processors);
+    if ((count + built) / 10000 != count / 10000)
+      logger.Log(std::to_string(count + built) + " models built");
+    count += built;
+    batch.clear();
+  };
+
   while (geometry_factory->NextGeometry()) {
-    builder->Setup(geometry_factory->Geometry());
-    if (builder->Build()) {
-      ++count;
-      if (count % 10000 == 0)
-        logger.Log(std::to_string(count + 1) + " models built");
-      processors.Process(builder->Model());
-    }
+    const Gauge::Geometry *geometry = geometry_factory->Geometry();
+    if (!JoinsBatch(batch, *geometry)) flush();
+    batch.push_back(*geometry);
   }
+  if (!batch.empty()) flush();
 
   processors.Finalize();
 
@@ -106,3 +741,29 @@ void Gauge::Survey::Serial(
   delete builder;
   delete geometry_factory;
 }
+
+void Gauge::Survey::Threaded(
+    Gauge::ProcessorList &&processors,
+    Gauge::GeometryFactory *geometry_factory,
+    Gauge::InputFactory::Generic *inputs,
+    std::string log_file,
+    int threads) {
+
+  threads = BuilderPool::Threads(threads);
+
+  Gauge::Logger logger(log_file);
+  logger.Log(std::to_string(threads) + " builders started.");
+
+  geometry_factory->Setup(inputs);
+
+  BuilderPool pool(&processors, threads);
+  while (geometry_factory->NextGeometry())
+    pool.Add(*geometry_factory->Geometry());
+  uint64_t count = pool.Finish();
+
+  processors.Finalize();
+
+  logger.Log("Models Constructed: " + std::to_string(count));
+
+  delete geometry_factory;
+}
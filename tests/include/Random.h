@@ -37,15 +37,18 @@
 #include <Datatypes/BasisVector.h>
 #include <Datatypes/Input.h>
 #include <Datatypes/GSOMatrix.h>
+#include <Datatypes/GSOSlice.h>
 #include <Datatypes/Geometry.h>
 #include <Datatypes/Group.h>
 #include <Datatypes/Model.h>
 #include <Datatypes/NVector.h>
+#include <Datatypes/NVectorSlice.h>
 #include <Datatypes/Rational.h>
 #include <Datatypes/Raw.h>
 #include <Datatypes/Sector.h>
 #include <Datatypes/State.h>
 #include <Datatypes/Vector.h>
+#include <Datatypes/WorkUnit.h>
 
 namespace Random {
   inline void Seed() { srand(time(NULL)); }
@@ -81,6 +84,26 @@ namespace Random {
     return vector;
   }
 
+  inline Gauge::GSOSlice *GSOSlice() {
+    uint64_t begin = Random::Int(0,1000);
+    uint64_t end = begin + Random::Int(0,1000);
+    Gauge::GSOSlice *slice = new Gauge::GSOSlice(begin, end);
+    slice->position = Random::Int(0,1000);
+    return slice;
+  }
+
+  inline Gauge::NVectorSlice *NVectorSlice() {
+    int layers = Random::Int(1,20);
+    int *orders = Random::IntArray(2,100,layers);
+    uint64_t begin = Random::Int(0,1000);
+    uint64_t end = begin + Random::Int(0,1000);
+    Gauge::NVectorSlice *slice =
+      new Gauge::NVectorSlice(orders, layers, Random::Int(16,23), begin, end);
+    slice->position = Random::Int(0,100000);
+    delete [] orders;
+    return slice;
+  }
+
   inline Gauge::Math::Rational *Rational() {
     int num = Random::Int(-100,100);
     int den = Random::Int(1,100);
@@ -228,6 +251,7 @@ namespace Random {
     Gauge::Basis *basis = Random::Basis(size, width);
     Gauge::GSOMatrix *gso_matrix = Random::GSOMatrix(size);
     Gauge::Geometry *geometry = new Gauge::Geometry(*basis, *gso_matrix);
+    geometry->multiplicity = Random::Int(1,1000);
 
     delete gso_matrix;
     delete basis;
@@ -241,4 +265,10 @@ namespace Random {
     model->susy = Random::Int(0,4);
     return model;
   }
+
+  inline Gauge::WorkUnit *WorkUnit() {
+    uint64_t begin = Random::Int(0,1000);
+    uint64_t end = begin + Random::Int(0,1000);
+    return new Gauge::WorkUnit(begin, end);
+  }
 }
@@ -0,0 +1,395 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file tests/src/GSOHandlerTest.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief This unittest is designed to define the operational parameters of the
+ * Gauge::GSOHandler class.
+ */
+
+#include <gtest/gtest.h>
+#include <Random.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include <BasisHandler.h>
+#include <GSOHandler.h>
+#include <Math.h>
+
+namespace {
+  /* The matrices of a single layer have a single free element, so the
+   * bases of two and three layers are included; those of order 3 can change
+   * sign. Only every kStride-th basis is used, to keep the unoptimized build
+   * quick. */
+  const int kConfigs = 6;
+  const int kLayers[kConfigs] = { 1, 1, 1, 2, 3, 2 };
+  const int kOrders[kConfigs][3] = {
+    { 2, 0, 0 }, { 3, 0, 0 }, { 4, 0, 0 }, { 2, 2, 0 }, { 2, 2, 2 },
+    { 3, 3, 0 } };
+  const int kStride[kConfigs] = { 1, 1, 1, 2, 97, 29 };
+  const int kDimensions = 4;
+  const int kTypes = 4;
+  const Gauge::Input::SUSYType kSUSYTypes[kTypes] = {
+    Gauge::Input::kSUSY, Gauge::Input::kFullSUSY, Gauge::Input::kNonSUSY,
+    Gauge::Input::kReducedSUSY };
+
+  /* The bases of a configuration used by the tests. */
+  std::vector<Gauge::Basis> Bases(int config) {
+    Gauge::Input input(kOrders[config], kLayers[config], kDimensions,
+        Gauge::Input::kSUSY);
+    Gauge::BasisHandler handler;
+    handler.Setup(input);
+    std::vector<Gauge::Basis> bases;
+    for (int index = 0; handler.NextBasis(); ++index) {
+      if (index % kStride[config] == 0) bases.push_back(handler.basis());
+    }
+    return bases;
+  }
+
+  void Enumerate(Gauge::GSOHandler *handler,
+                 std::vector<Gauge::GSOMatrix> *stream) {
+    while (handler->NextGSOMatrix()) stream->push_back(handler->GSOMatrix());
+  }
+}
+
+TEST(Count, Enumeration) {
+  for (int config = 0; config < kConfigs; ++config) {
+    std::vector<Gauge::Basis> bases = Bases(config);
+    uint64_t total = 0;
+    for (int type = 0; type < kTypes; ++type) {
+      for (size_t index = 0; index < bases.size(); ++index) {
+        Gauge::GSOHandler handler;
+        handler.Setup(bases[index], kSUSYTypes[type]);
+        uint64_t count = handler.Count();
+        uint64_t enumerated = 0;
+        while (handler.NextGSOMatrix()) ++enumerated;
+        EXPECT_EQ(enumerated, count) << "config " << config << ", type "
+                                     << type << ", basis " << index;
+        total += enumerated;
+      }
+    }
+    EXPECT_LT(0u, total) << "config " << config;
+  }
+}
+
+TEST(Count, MaximumRanks) {
+  for (int config = 0; config < kConfigs; ++config) {
+    std::vector<Gauge::Basis> bases = Bases(config);
+    for (int type = 0; type < kTypes; ++type) {
+      Gauge::Input input(kOrders[config], kLayers[config], kDimensions,
+          kSUSYTypes[type]);
+      uint64_t ranks = Gauge::GSOHandler::MaximumRanks(input);
+      for (size_t index = 0; index < bases.size(); ++index) {
+        Gauge::GSOHandler handler;
+        handler.Setup(bases[index], kSUSYTypes[type]);
+        EXPECT_LE(handler.Ranks(), ranks) << "config " << config << ", type "
+                                          << type << ", basis " << index;
+      }
+    }
+  }
+
+  // Six layers of order 64 have more ranks than 64 bits hold.
+  const int orders[6] = { 64, 64, 64, 64, 64, 64 };
+  Gauge::Input input(orders, 6, kDimensions, Gauge::Input::kNonSUSY);
+  EXPECT_EQ(0u, Gauge::GSOHandler::MaximumRanks(input));
+}
+
+TEST(Split, Concatenation) {
+  for (int config = 0; config < kConfigs; ++config) {
+    std::vector<Gauge::Basis> bases = Bases(config);
+    for (int type = 0; type < kTypes; ++type) {
+      for (size_t index = 0; index < bases.size(); ++index) {
+        Gauge::GSOHandler handler;
+        handler.Setup(bases[index], kSUSYTypes[type]);
+        std::vector<Gauge::GSOMatrix> expected;
+        Enumerate(&handler, &expected);
+
+        const int parts[] = { 1, 3, 7 };
+        for (int part = 0; part < 3; ++part) {
+          std::vector<Gauge::GSOSlice> slices(parts[part]);
+          handler.Split(parts[part], slices.data());
+          std::vector<Gauge::GSOMatrix> stream;
+          Gauge::GSOHandler worker;
+          worker.Setup(bases[index], kSUSYTypes[type]);
+          for (int slice = 0; slice < parts[part]; ++slice) {
+            if (slice > 0) {
+              EXPECT_EQ(slices[slice - 1].end, slices[slice].begin);
+            }
+            worker.Seek(slices[slice]);
+            Enumerate(&worker, &stream);
+          }
+          EXPECT_TRUE(stream == expected) << "config " << config << ", type "
+                                          << type << ", basis " << index
+                                          << ", " << parts[part] << " parts";
+        }
+      }
+    }
+  }
+}
+
+TEST(Slice, Resume) {
+  Random::Seed();
+  for (int config = 0; config < kConfigs; ++config) {
+    std::vector<Gauge::Basis> bases = Bases(config);
+    for (int type = 0; type < kTypes; ++type) {
+      for (size_t index = 0; index < bases.size(); ++index) {
+        Gauge::GSOHandler handler;
+        handler.Setup(bases[index], kSUSYTypes[type]);
+        std::vector<Gauge::GSOMatrix> expected;
+        Enumerate(&handler, &expected);
+
+        int pause = expected.empty() ? 0 : Random::Int(0, expected.size());
+        Gauge::GSOHandler first;
+        first.Setup(bases[index], kSUSYTypes[type]);
+        std::vector<Gauge::GSOMatrix> stream;
+        while (static_cast<int>(stream.size()) < pause &&
+               first.NextGSOMatrix())
+          stream.push_back(first.GSOMatrix());
+
+        Gauge::GSOHandler second;
+        second.Setup(bases[index], kSUSYTypes[type]);
+        second.Seek(first.Slice());
+        Enumerate(&second, &stream);
+        EXPECT_TRUE(stream == expected) << "config " << config << ", type "
+                                        << type << ", basis " << index
+                                        << ", paused at " << pause;
+      }
+    }
+  }
+}
+
+TEST(Permutation, Multiplicity) {
+  uint64_t reduced = 0;
+  for (int config = 0; config < kConfigs; ++config) {
+    std::vector<Gauge::Basis> bases = Bases(config);
+    for (int type = 0; type < kTypes; ++type) {
+      for (size_t index = 0; index < bases.size(); ++index) {
+        Gauge::GSOHandler handler;
+        handler.Setup(bases[index], kSUSYTypes[type]);
+        std::vector<Gauge::GSOMatrix> expected;
+        Enumerate(&handler, &expected);
+
+        Gauge::GSOHandler permuted(true);
+        permuted.Setup(bases[index], kSUSYTypes[type]);
+        EXPECT_EQ(handler.Count(), permuted.Count());
+        uint64_t total = 0, produced = 0;
+        while (permuted.NextGSOMatrix()) {
+          EXPECT_LE(1u, permuted.Multiplicity());
+          EXPECT_TRUE(std::find(expected.begin(), expected.end(),
+                                permuted.GSOMatrix()) != expected.end());
+          total += permuted.Multiplicity();
+          ++produced;
+        }
+        EXPECT_EQ(handler.Count(), total) << "config " << config << ", type "
+                                          << type << ", basis " << index;
+        reduced += expected.size() - produced;
+      }
+    }
+  }
+  EXPECT_LT(0u, reduced);
+}
+
+namespace {
+  /* The vector and order of a row of the projection, as the batch
+   * projections use them. */
+  int RowVector(const Gauge::Basis &basis, int extra_layers, int row,
+                std::vector<int> *vector) {
+    int width = basis.base[0].size;
+    if (row > 0 && row < extra_layers) {
+      vector->assign(width, 0);
+      return 1;
+    }
+    const Gauge::BasisVector &base = (row == 0) ?
+      Gauge::kPeriodicBasisVector : basis.base[row - extra_layers];
+    vector->assign(base.base, base.base + width);
+    return base.order;
+  }
+
+  /* The phase of a row of the Gauge::GSOMatrix for a sector. */
+  Gauge::Math::Rational Phase(const Gauge::GSOMatrix &gso, int row,
+                              const int *coefficients) {
+    using namespace Gauge::Math;
+    Rational phase(0);
+    for (int column = 0; column < gso.size; ++column) {
+      Reduce(Add(&phase, Multiply(gso.base[row][column],
+                                  Rational(coefficients[column]))));
+    }
+    return phase;
+  }
+
+  /* Adjusts the values of a state, of the provided denominator, until it
+   * survives the projection of the Gauge::GSOMatrix. The basis vectors are
+   * solved for in order, each through a column none of the earlier ones
+   * use, and the all periodic vector last. Returns false when the sector
+   * has no surviving states, or the basis no such columns. */
+  bool Survive(const Gauge::Basis &basis, const Gauge::GSOMatrix &gso,
+               const int *coefficients, int den, int *values) {
+    int extra_layers = gso.size - basis.size;
+    int width = basis.base[0].size;
+    for (int row = 1; row < extra_layers; ++row) {
+      Gauge::Math::Rational phase = Phase(gso, row, coefficients);
+      if (phase.den != 1 || phase.num % 2 != 0) return false;
+    }
+
+    std::vector<bool> used(width, false);
+    std::vector<int> vector;
+    for (int step = extra_layers; step <= gso.size; ++step) {
+      int row = (step == gso.size) ? 0 : step;
+      int order = RowVector(basis, extra_layers, row, &vector);
+      Gauge::Math::Rational phase = Phase(gso, row, coefficients);
+      int64_t scale = static_cast<int64_t>(den) * order;
+      if (scale % phase.den != 0) return false;
+      int64_t modulus = 2 * scale;
+      int64_t product = 0;
+      for (int k = 0; k < width; ++k)
+        product += static_cast<int64_t>(values[k]) * vector[k];
+      int64_t need = (phase.num * (scale / phase.den) - product) % modulus;
+      if (need < 0) need += modulus;
+
+      int column = -1;
+      for (int k = 0; k < width && column < 0; ++k) {
+        if (!used[k] && vector[k] != 0) column = k;
+      }
+      if (column < 0) return false;
+      // Solve vector[column] * x = need modulo the modulus.
+      int64_t a = vector[column] % modulus, m = modulus;
+      if (a < 0) a += modulus;
+      int64_t g = m, x0 = 0, x1 = 1, r = a;
+      while (r != 0) {
+        int64_t q = g / r, t = g - q * r;
+        g = r;
+        r = t;
+        t = x0 - q * x1;
+        x0 = x1;
+        x1 = t;
+      }
+      if (need % g != 0) return false;
+      int64_t period = modulus / g;
+      int64_t x = ((x0 % period) * ((need / g) % period)) % period;
+      if (x < 0) x += period;
+      values[column] += static_cast<int>(x);
+      for (int k = 0; k < width; ++k) used[k] = used[k] || vector[k] != 0;
+    }
+    return true;
+  }
+
+  /* Compares both batch projections with the scalar projection of each
+   * state, against up to 64 Gauge::GSOMatrix instances of the basis. Half of
+   * the states survive the first Gauge::GSOMatrix by construction, the rest
+   * are random. Returns the number of states surviving the first matrix,
+   * and the largest modulus of the congruences tested through @c largest. */
+  int CompareProjections(const Gauge::Basis &basis, int64_t *largest) {
+    using namespace Gauge::Math;
+    Gauge::GSOHandler handler;
+    handler.Setup(basis, Gauge::Input::kSUSY);
+    std::vector<Gauge::GSOMatrix> matrices;
+    while (matrices.size() < 64 && handler.NextGSOMatrix())
+      matrices.push_back(handler.GSOMatrix());
+    if (matrices.empty()) return 0;
+
+    int size = matrices[0].size;
+    int extra_layers = size - basis.size;
+    int width = basis.base[0].size;
+    int den = 2;
+    for (int vector = 0; vector < basis.size; ++vector)
+      den = LCM(den, basis.base[vector].order);
+
+    const int count = 64;
+    std::vector<int> values(count * width);
+    std::vector<int> coefficients(size, 0);
+    for (int attempt = 0; attempt < 1000; ++attempt) {
+      for (int column = extra_layers; column < size; ++column) {
+        coefficients[column] =
+          Random::Int(0, basis.base[column - extra_layers].order - 1);
+      }
+      bool survives = true;
+      for (int state = 0; state < count && survives; ++state) {
+        int *state_values = values.data() + state * width;
+        for (int k = 0; k < width; ++k)
+          state_values[k] = Random::Int(-den, den);
+        if (state < count / 2) {
+          survives = Survive(basis, matrices[0], coefficients.data(), den,
+                             state_values);
+        }
+      }
+      if (survives) break;
+    }
+
+    std::vector<uint64_t> masks(count);
+    Gauge::GSOHandler::Project(basis, matrices.data(), matrices.size(),
+                               values.data(), count, den, coefficients.data(),
+                               masks.data());
+    std::vector<char> survivors(count);
+    int surviving = 0;
+    for (size_t matrix = 0; matrix < matrices.size(); ++matrix) {
+      Gauge::Geometry geometry(basis, matrices[matrix]);
+      Gauge::GSOHandler::Project(geometry, values.data(), count, den,
+                                 coefficients.data(), survivors.data());
+      for (int state = 0; state < count; ++state) {
+        Gauge::State single(width, den);
+        std::copy(values.begin() + state * width,
+                  values.begin() + (state + 1) * width, single.base);
+        single.leading = 0;
+        single.trailing = width;
+        bool expected = Gauge::GSOHandler::Project(geometry, single,
+                                                   coefficients.data());
+        EXPECT_EQ(expected, survivors[state] != 0)
+          << "matrix " << matrix << ", state " << state;
+        EXPECT_EQ(expected, ((masks[state] >> matrix) & 1) != 0)
+          << "matrix " << matrix << ", state " << state;
+        if (matrix == 0 && expected) ++surviving;
+      }
+      std::vector<int> vector;
+      for (int row = 0; row < size; ++row) {
+        int64_t modulus = INT64_C(2) * den *
+          RowVector(basis, extra_layers, row, &vector) *
+          Phase(matrices[matrix], row, coefficients.data()).den;
+        *largest = std::max(*largest, modulus);
+      }
+    }
+    return surviving;
+  }
+}
+
+TEST(Project, Scalar) {
+  Random::Seed();
+  int64_t largest = 0;
+  for (int config = 0; config < kConfigs; ++config) {
+    std::vector<Gauge::Basis> bases = Bases(config);
+    for (size_t index = 0; index < bases.size(); ++index)
+      CompareProjections(bases[index], &largest);
+  }
+
+  /* Three layers of large coprime orders, whose congruences are taken
+   * modulo more than 2^31. */
+  const int layers = 3;
+  const int orders[layers] = { 22, 23, 25 };
+  Gauge::Input input(orders, layers, kDimensions, Gauge::Input::kSUSY);
+  Gauge::BasisHandler handler;
+  handler.Setup(input);
+  largest = 0;
+  int surviving = 0;
+  for (int index = 0; index < 4 && handler.NextBasis(); ++index)
+    surviving += CompareProjections(handler.basis(), &largest);
+  EXPECT_LT(INT64_C(1) << 31, largest);
+  EXPECT_LT(0, surviving);
+}
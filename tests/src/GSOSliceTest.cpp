@@ -0,0 +1,96 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file tests/src/GSOSliceTest.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief This unittest is designed to define the operational parameters of the
+ * Gauge::GSOSlice class.
+ */
+
+#include <gtest/gtest.h>
+#include <Random.h>
+
+TEST(Constructors, Default) {
+  Gauge::GSOSlice slice;
+  EXPECT_EQ(0u, slice.begin);
+  EXPECT_EQ(0u, slice.end);
+  EXPECT_EQ(0u, slice.position);
+}
+
+TEST(Constructors, Full) {
+  Random::Seed();
+  for (int trial = 0; trial < 100; ++trial) {
+    uint64_t begin = Random::Int(0,1000);
+    uint64_t end = begin + Random::Int(0,1000);
+    Gauge::GSOSlice slice(begin, end);
+
+    EXPECT_EQ(begin, slice.begin);
+    EXPECT_EQ(end, slice.end);
+    EXPECT_EQ(0u, slice.position);
+  }
+}
+
+TEST(Operators, Equals) {
+  for (int trial = 0; trial < 100; ++trial) {
+    Gauge::GSOSlice *lhs = Random::GSOSlice();
+    Gauge::GSOSlice rhs = *lhs;
+
+    EXPECT_TRUE(*lhs == rhs);
+    ++rhs.position;
+    EXPECT_FALSE(*lhs == rhs);
+    --rhs.position;
+    ++rhs.end;
+    EXPECT_FALSE(*lhs == rhs);
+
+    delete lhs;
+  }
+}
+
+TEST(Operators, NotEquals) {
+  for (int trial = 0; trial < 100; ++trial) {
+    Gauge::GSOSlice *lhs = Random::GSOSlice();
+    Gauge::GSOSlice rhs = *lhs;
+
+    EXPECT_FALSE(*lhs != rhs);
+    ++rhs.begin;
+    EXPECT_TRUE(*lhs != rhs);
+
+    delete lhs;
+  }
+}
+
+TEST(SerialiableInterface, WriteReadInvariance) {
+  for (int trial = 0; trial < 100; ++trial) {
+    Gauge::GSOSlice *input = Random::GSOSlice();
+    Gauge::Raw *raw_input = input->Serialize();
+
+    Gauge::GSOSlice *output = Random::GSOSlice();
+    output->Deserialize(raw_input);
+
+    EXPECT_EQ(*input, *output);
+
+    EXPECT_EQ(0, raw_input->size);
+    EXPECT_EQ(NULL, raw_input->data);
+
+    delete output;
+    delete raw_input;
+    delete input;
+  }
+}
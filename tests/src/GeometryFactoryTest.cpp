@@ -0,0 +1,177 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file tests/src/GeometryFactoryTest.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief This unittest is designed to define the operational parameters of the
+ * Gauge::GeometryFactory class.
+ */
+
+#include <gtest/gtest.h>
+#include <Random.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <GeometryFactory.h>
+#include <NVectorCatalog.h>
+#include <NVectorHandler.h>
+
+namespace {
+  /* Four inputs of two layers, small enough that the unoptimized build
+   * enumerates every Gauge::Geometry of them in about a second. */
+  const int kLayers = 2;
+  const int kLower[kLayers] = { 2, 2 };
+  const int kUpper[kLayers] = { 3, 3 };
+  const int kDimensions = 10;
+
+  struct Entry {
+    uint64_t ordinal;
+    Gauge::Geometry geometry;
+  };
+
+  Gauge::GeometryFactory *Factory(bool permutations) {
+    Gauge::GeometryFactory *factory = permutations ?
+      Gauge::GeometryFactory::PermutationFactory() :
+      Gauge::GeometryFactory::SystematicFactory();
+    factory->Setup(new Gauge::InputFactory::Range(kLower, kUpper, kLayers,
+          kDimensions, Gauge::Input::kNonSUSY));
+    return factory;
+  }
+
+  /* Reads the geometries with ordinals in [begin, end), after seeking to the
+   * beginning. */
+  void Read(bool permutations, uint64_t begin, uint64_t end,
+            std::vector<Entry> *stream) {
+    Gauge::GeometryFactory *factory = Factory(permutations);
+    factory->Seek(begin);
+    while (factory->NextGeometry() && factory->Position() < end) {
+      EXPECT_LE(begin, factory->Position());
+      Entry entry = { factory->Position(), *factory->Geometry() };
+      stream->push_back(entry);
+    }
+    delete factory;
+  }
+
+  bool Same(const std::vector<Entry> &lhs, const std::vector<Entry> &rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    for (size_t index = 0; index < lhs.size(); ++index) {
+      if (lhs[index].ordinal != rhs[index].ordinal) return false;
+      if (!(lhs[index].geometry == rhs[index].geometry)) return false;
+    }
+    return true;
+  }
+
+  /* Splits the ordinals of the unseeked stream at random boundaries, and
+   * compares the concatenation of the ranges against it. */
+  void CompareRanges(bool permutations) {
+    std::vector<Entry> expected;
+    Gauge::GeometryFactory *factory = Factory(permutations);
+    while (factory->NextGeometry()) {
+      if (!expected.empty()) {
+        EXPECT_LT(expected.back().ordinal, factory->Position());
+      }
+      Entry entry = { factory->Position(), *factory->Geometry() };
+      expected.push_back(entry);
+    }
+    uint64_t total = factory->Position();
+    delete factory;
+    ASSERT_FALSE(expected.empty());
+    EXPECT_LT(expected.back().ordinal, total);
+
+    // Skipping the inputs by their counts ends at the same ordinal.
+    factory = Factory(permutations);
+    while (factory->SkipInput()) continue;
+    EXPECT_EQ(total, factory->Position());
+    EXPECT_FALSE(factory->Overflow());
+    delete factory;
+
+    const int parts[] = { 1, 2, 5, 17 };
+    for (int part = 0; part < 4; ++part) {
+      std::vector<uint64_t> bounds;
+      bounds.push_back(0);
+      for (int index = 1; index < parts[part]; ++index)
+        bounds.push_back(static_cast<uint64_t>(
+              total * (Random::Int(0, 1000000) / 1000000.0L)));
+      bounds.push_back(total);
+      std::sort(bounds.begin(), bounds.end());
+
+      std::vector<Entry> stream;
+      for (int index = 0; index < parts[part]; ++index)
+        Read(permutations, bounds[index], bounds[index + 1], &stream);
+      EXPECT_TRUE(Same(expected, stream)) << parts[part] << " parts";
+    }
+  }
+}
+
+TEST(Seek, Systematic) {
+  Random::Seed();
+  CompareRanges(false);
+}
+
+TEST(Seek, Permutation) {
+  Random::Seed();
+  CompareRanges(true);
+}
+
+TEST(Seek, Catalog) {
+  Random::Seed();
+  char directory[] = "/tmp/gauge-catalogs-XXXXXX";
+  ASSERT_TRUE(mkdtemp(directory) != NULL);
+  Gauge::NVectorCatalog::SetDirectory(directory);
+  std::string path = Gauge::NVectorCatalog::Path(kLower, kLayers,
+      26 - kDimensions);
+  Gauge::NVectorHandler handler;
+  handler.Setup(kLower, kLayers, 26 - kDimensions);
+  ASSERT_TRUE(handler.Export(path));
+
+  CompareRanges(false);
+
+  Gauge::NVectorCatalog::SetDirectory("");
+  remove(path.c_str());
+  rmdir(directory);
+}
+
+TEST(Seek, Within) {
+  /* Seeking to a Gauge::Geometry close ahead, as within a basis, lands on
+   * it exactly. */
+  Gauge::GeometryFactory *factory = Factory(false);
+  std::vector<uint64_t> ordinals;
+  while (factory->NextGeometry() && ordinals.size() < 64)
+    ordinals.push_back(factory->Position());
+  delete factory;
+  ASSERT_EQ(64u, ordinals.size());
+
+  factory = Factory(false);
+  ASSERT_TRUE(factory->NextGeometry());
+  EXPECT_EQ(ordinals[0], factory->Position());
+  factory->Seek(ordinals[40]);
+  ASSERT_TRUE(factory->NextGeometry());
+  EXPECT_EQ(ordinals[40], factory->Position());
+  factory->Seek(ordinals[41]);
+  ASSERT_TRUE(factory->NextGeometry());
+  EXPECT_EQ(ordinals[41], factory->Position());
+  delete factory;
+}
@@ -34,6 +34,7 @@ TEST(Constructors, Default) {
 
     EXPECT_EQ(Gauge::Basis(), geometry->basis);
     EXPECT_EQ(Gauge::GSOMatrix(), geometry->gso_matrix);
+    EXPECT_EQ(1u, geometry->multiplicity);
 
     delete geometry;
   }
@@ -49,6 +50,7 @@ TEST(Constructors, Full) {
 
     EXPECT_EQ(*basis, geometry->basis);
     EXPECT_EQ(*gsomatrix, geometry->gso_matrix);
+    EXPECT_EQ(1u, geometry->multiplicity);
 
     delete geometry;
     delete gsomatrix;
@@ -62,6 +64,7 @@ TEST(Constructor, Copy) {
     Gauge::Geometry *copy = new Gauge::Geometry(*geometry);
 
     EXPECT_EQ(*geometry, *copy);
+    EXPECT_EQ(geometry->multiplicity, copy->multiplicity);
 
     delete geometry;
     delete copy;
@@ -74,6 +77,7 @@ TEST(Operators, Assignment) {
     Gauge::Geometry copy = *geometry;
 
     EXPECT_EQ(*geometry, copy);
+    EXPECT_EQ(geometry->multiplicity, copy.multiplicity);
 
     delete geometry;
   }
@@ -118,6 +122,7 @@ TEST(SerialiableInterface, WriteReadInvariance) {
     output->Deserialize(raw_input);
 
     EXPECT_EQ(*input, *output);
+    EXPECT_EQ(input->multiplicity, output->multiplicity);
 
     EXPECT_EQ(0, raw_input->size);
     EXPECT_EQ(NULL, raw_input->data);
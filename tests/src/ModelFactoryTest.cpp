@@ -0,0 +1,122 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file tests/src/ModelFactoryTest.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief This unittest is designed to define the operational parameters of the
+ * Gauge::ModelFactory class.
+ */
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <vector>
+
+#include <BasisHandler.h>
+#include <GSOHandler.h>
+#include <ModelFactory.h>
+
+namespace {
+  /* The inputs of the batches, with the number of bases whose models are
+   * compared. Some bases of three layers of order 2 pair with exactly
+   * Gauge::ModelFactory::kBatch matrices. */
+  const int kConfigs = 3;
+  const int kLayers[kConfigs] = { 2, 3, 3 };
+  const int kOrders[kConfigs][3] = { { 2, 3, 0 }, { 2, 2, 2 }, { 2, 2, 4 } };
+  const int kDimensions = 4;
+  const int kBases = 2;
+
+  /* The states of a model, by sector. */
+  const std::vector<std::list<Gauge::State*>> &States(
+      const Gauge::Model &model) {
+    return const_cast<Gauge::StateList&>(model.states).BySector();
+  }
+
+  /* Builds the models of a batch one by one and as a batch, and compares
+   * them. Returns the number of models built. */
+  int CompareBatch(const std::vector<Gauge::Geometry> &geometries) {
+    std::vector<const Gauge::Geometry*> pointers;
+    for (size_t index = 0; index < geometries.size(); ++index)
+      pointers.push_back(&geometries[index]);
+    Gauge::ModelFactory batch;
+    batch.Setup(pointers.data(), pointers.size());
+
+    int built = 0;
+    for (size_t index = 0; index < geometries.size(); ++index) {
+      Gauge::ModelFactory single;
+      single.Setup(&geometries[index]);
+      bool expected = single.Build();
+      EXPECT_EQ(expected, batch.Build(index)) << "matrix " << index;
+      if (!expected) continue;
+      ++built;
+
+      const Gauge::Model &lhs = single.Model();
+      const Gauge::Model &rhs = batch.Model();
+      EXPECT_EQ(lhs.susy, rhs.susy) << "matrix " << index;
+      EXPECT_TRUE(*lhs.geometry == *rhs.geometry) << "matrix " << index;
+      EXPECT_TRUE(*lhs.group == *rhs.group) << "matrix " << index;
+      EXPECT_EQ(single.Group(), batch.Group()) << "matrix " << index;
+
+      const std::vector<std::list<Gauge::State*>> &lhs_states = States(lhs);
+      const std::vector<std::list<Gauge::State*>> &rhs_states = States(rhs);
+      EXPECT_EQ(lhs_states.size(), rhs_states.size());
+      for (size_t sector = 0; sector < lhs_states.size(); ++sector) {
+        EXPECT_EQ(lhs_states[sector].size(), rhs_states[sector].size())
+          << "matrix " << index << ", sector " << sector;
+        if (lhs_states[sector].size() != rhs_states[sector].size()) continue;
+        std::list<Gauge::State*>::const_iterator state =
+          rhs_states[sector].begin();
+        for (Gauge::State *other : lhs_states[sector]) {
+          EXPECT_TRUE(*other == **state) << "matrix " << index << ", sector "
+                                         << sector;
+          ++state;
+        }
+      }
+    }
+    return built;
+  }
+}
+
+TEST(Build, Batch) {
+  int full = 0;
+  for (int config = 0; config < kConfigs; ++config) {
+    Gauge::Input input(kOrders[config], kLayers[config], kDimensions,
+        Gauge::Input::kSUSY);
+    Gauge::BasisHandler bases;
+    bases.Setup(input);
+    int compared = 0;
+    while (compared < kBases && bases.NextBasis()) {
+      Gauge::GSOHandler handler;
+      handler.Setup(bases.basis(), Gauge::Input::kSUSY);
+      std::vector<Gauge::Geometry> geometries;
+      while (geometries.size() < Gauge::ModelFactory::kBatch &&
+             handler.NextGSOMatrix()) {
+        geometries.push_back(Gauge::Geometry(bases.basis(),
+                                             handler.GSOMatrix()));
+      }
+      if (geometries.empty()) continue;
+      int built = CompareBatch(geometries);
+      if (built == 0) continue;
+      ++compared;
+      if (geometries.size() == Gauge::ModelFactory::kBatch) ++full;
+    }
+  }
+  EXPECT_LT(0, full);
+}
@@ -0,0 +1,215 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file tests/src/NVectorCatalogTest.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief This unittest is designed to define the operational parameters of the
+ * Gauge::NVectorCatalog class.
+ */
+
+#include <gtest/gtest.h>
+#include <Random.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include <BasisHandler.h>
+#include <NVectorCatalog.h>
+#include <NVectorHandler.h>
+
+namespace {
+  const int kConfigs = 5;
+  const int kLayers[kConfigs] = { 1, 1, 2, 2, 2 };
+  const int kOrders[kConfigs][2] = {
+    { 4, 0 }, { 6, 0 }, { 2, 2 }, { 2, 3 }, { 3, 2 } };
+  const int kDimensions = 4;
+
+  /* A fixture that exports the catalogs of every configuration into a fresh
+   * directory, and removes them again afterwards. */
+  class Catalogs : public ::testing::Test {
+    protected:
+      virtual void SetUp() {
+        char directory[] = "/tmp/gauge-catalogs-XXXXXX";
+        ASSERT_TRUE(mkdtemp(directory) != NULL);
+        directory_ = directory;
+        Gauge::NVectorCatalog::SetDirectory(directory_);
+        for (int config = 0; config < kConfigs; ++config) {
+          std::string path = Path(config);
+          Gauge::NVectorHandler handler;
+          handler.Setup(kOrders[config], kLayers[config], 26 - kDimensions);
+          ASSERT_TRUE(handler.Export(path));
+          paths_.push_back(path);
+        }
+      }
+      virtual void TearDown() {
+        Gauge::NVectorCatalog::SetDirectory("");
+        for (size_t index = 0; index < paths_.size(); ++index)
+          remove(paths_[index].c_str());
+        rmdir(directory_.c_str());
+      }
+
+      std::string Path(int config) const {
+        return Gauge::NVectorCatalog::Path(kOrders[config], kLayers[config],
+            26 - kDimensions);
+      }
+
+      /* The bases enumerated by searching, with catalogs disabled. */
+      std::vector<Gauge::Basis> LiveBases(int config) const;
+
+      std::string directory_;
+      std::vector<std::string> paths_;
+  };
+
+  Gauge::Input MakeInput(int config) {
+    return Gauge::Input(kOrders[config], kLayers[config], kDimensions,
+        Gauge::Input::kSUSY);
+  }
+
+  void Bases(Gauge::BasisHandler *handler, std::vector<Gauge::Basis> *bases) {
+    while (handler->NextBasis()) bases->push_back(handler->basis());
+  }
+
+  std::vector<Gauge::Basis> Catalogs::LiveBases(int config) const {
+    Gauge::NVectorCatalog::SetDirectory("");
+    Gauge::BasisHandler handler;
+    handler.Setup(MakeInput(config));
+    std::vector<Gauge::Basis> bases;
+    Bases(&handler, &bases);
+    Gauge::NVectorCatalog::SetDirectory(directory_);
+    return bases;
+  }
+}
+
+TEST_F(Catalogs, Open) {
+  for (int config = 0; config < kConfigs; ++config) {
+    Gauge::NVectorCatalog catalog;
+    ASSERT_TRUE(catalog.Open(Path(config), kOrders[config], kLayers[config],
+          26 - kDimensions));
+
+    Gauge::NVectorHandler handler;
+    handler.Setup(kOrders[config], kLayers[config], 26 - kDimensions);
+    EXPECT_EQ(handler.Count(), catalog.count());
+    EXPECT_FALSE(catalog.Open(Path(config), kOrders[config], kLayers[config],
+          25 - kDimensions));
+  }
+}
+
+TEST_F(Catalogs, OpenRejectsWidth) {
+  const int config = 3;
+  std::string path = Path(config);
+  FILE *file = fopen(path.c_str(), "r+b");
+  ASSERT_TRUE(file != NULL);
+  Gauge::NVectorCatalog::Header header;
+  ASSERT_EQ(1u, fread(&header, sizeof(header), 1, file));
+  ++header.width;
+  ASSERT_EQ(0, fseek(file, 0, SEEK_SET));
+  ASSERT_EQ(1u, fwrite(&header, sizeof(header), 1, file));
+  fclose(file);
+
+  Gauge::NVectorCatalog catalog;
+  EXPECT_FALSE(catalog.Open(path, kOrders[config], kLayers[config],
+        26 - kDimensions));
+}
+
+TEST_F(Catalogs, OpenRejectsCounts) {
+  const int config = 3;
+  std::string path = Path(config);
+  FILE *file = fopen(path.c_str(), "r+b");
+  ASSERT_TRUE(file != NULL);
+  Gauge::NVectorCatalog::Header original;
+  ASSERT_EQ(1u, fread(&original, sizeof(original), 1, file));
+
+  /* Counts whose offsets would overflow, or point past the end of the file. */
+  const int corruptions = 4;
+  const uint64_t ordinals[corruptions] = {
+    UINT64_MAX / sizeof(uint64_t), UINT64_MAX, original.ordinals + 1,
+    original.ordinals };
+  const uint64_t counts[corruptions] = {
+    original.count, original.count, original.count,
+    UINT64_MAX / original.width + 1 };
+  for (int index = 0; index < corruptions; ++index) {
+    Gauge::NVectorCatalog::Header header = original;
+    header.ordinals = ordinals[index];
+    header.count = counts[index];
+    ASSERT_EQ(0, fseek(file, 0, SEEK_SET));
+    ASSERT_EQ(1u, fwrite(&header, sizeof(header), 1, file));
+    ASSERT_EQ(0, fflush(file));
+
+    Gauge::NVectorCatalog catalog;
+    EXPECT_FALSE(catalog.Open(path, kOrders[config], kLayers[config],
+          26 - kDimensions)) << "corruption " << index;
+  }
+  fclose(file);
+}
+
+TEST_F(Catalogs, OpenRejectsTruncated) {
+  const int config = 3;
+  std::string path = Path(config);
+  Gauge::NVectorCatalog::Header header;
+  FILE *file = fopen(path.c_str(), "rb");
+  ASSERT_TRUE(file != NULL);
+  ASSERT_EQ(1u, fread(&header, sizeof(header), 1, file));
+  fclose(file);
+
+  off_t length = Gauge::NVectorCatalog::RecordOffset(kLayers[config],
+      header.ordinals) + header.count * header.width;
+  ASSERT_EQ(0, truncate(path.c_str(), length - 1));
+  Gauge::NVectorCatalog catalog;
+  EXPECT_FALSE(catalog.Open(path, kOrders[config], kLayers[config],
+        26 - kDimensions));
+  ASSERT_EQ(0, truncate(path.c_str(), sizeof(header) + 8));
+  EXPECT_FALSE(catalog.Open(path, kOrders[config], kLayers[config],
+        26 - kDimensions));
+}
+
+TEST_F(Catalogs, Replay) {
+  for (int config = 0; config < kConfigs; ++config) {
+    std::vector<Gauge::Basis> expected = LiveBases(config);
+
+    Gauge::BasisHandler handler;
+    handler.Setup(MakeInput(config));
+    std::vector<Gauge::Basis> bases;
+    Bases(&handler, &bases);
+    EXPECT_TRUE(bases == expected) << "config " << config;
+  }
+}
+
+TEST_F(Catalogs, ReplaySlices) {
+  for (int config = 0; config < kConfigs; ++config) {
+    std::vector<Gauge::Basis> expected = LiveBases(config);
+
+    Gauge::NVectorHandler splitter;
+    splitter.Setup(kOrders[config], kLayers[config], 26 - kDimensions);
+    const int parts = 3;
+    Gauge::NVectorSlice slices[parts];
+    splitter.Split(parts, slices);
+    std::vector<Gauge::Basis> bases;
+    for (int index = 0; index < parts; ++index) {
+      Gauge::BasisHandler handler;
+      handler.Setup(MakeInput(config), slices[index]);
+      Bases(&handler, &bases);
+    }
+    EXPECT_TRUE(bases == expected) << "config " << config;
+  }
+}
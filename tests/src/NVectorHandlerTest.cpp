@@ -0,0 +1,265 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file tests/src/NVectorHandlerTest.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief This unittest is designed to define the operational parameters of the
+ * Gauge::NVectorHandler class.
+ */
+
+#include <gtest/gtest.h>
+#include <Random.h>
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include <NVectorHandler.h>
+
+namespace {
+  /* Small orders and sizes, so that the unoptimized build enumerates each of
+   * them in well under a second. */
+  const int kConfigs = 6;
+  const int kLayers[kConfigs] = { 1, 1, 2, 2, 2, 3 };
+  const int kOrders[kConfigs][3] = {
+    { 6, 0, 0 }, { 8, 0, 0 }, { 2, 2, 0 }, { 2, 3, 0 }, { 3, 2, 0 },
+    { 2, 2, 2 } };
+  const int kSize = 20;
+
+  /* Exposes the distribution of a segment to the tests. */
+  class Distributor : public Gauge::NVectorHandler {
+    public:
+      using Gauge::NVectorHandler::DistributeArray;
+  };
+
+  void Enumerate(Gauge::NVectorHandler *handler,
+                 std::vector<Gauge::NVector> *stream) {
+    while (handler->NextSolution())
+      stream->push_back(*handler->CurrentSolution());
+  }
+}
+
+TEST(NextSolution, Stream) {
+  /* The number and an FNV-style hash of the printed NVectors, in order,
+   * produced by the original recursive search at size 22. */
+  const int configs = 8;
+  const int layers[configs] = { 1, 1, 1, 2, 2, 2, 2, 3 };
+  const int orders[configs][3] = {
+    { 4, 0, 0 }, { 6, 0, 0 }, { 8, 0, 0 }, { 2, 2, 0 }, { 2, 3, 0 },
+    { 3, 2, 0 }, { 4, 2, 0 }, { 2, 2, 2 } };
+  const uint64_t counts[configs] = {
+    38, 193, 937, 80, 3697, 3697, 16102, 4151 };
+  const uint64_t hashes[configs] = {
+    0xcdabfb9cd27d64edULL, 0xe7afbf87afd20f69ULL, 0x128f69f599916de4ULL,
+    0xb4b83449e9f0387cULL, 0xe355c8ab8b7a4808ULL, 0x6d2d5575e234c7e0ULL,
+    0x460f39eec78b06d6ULL, 0x008564debf1e21faULL };
+  for (int config = 0; config < configs; ++config) {
+    Gauge::NVectorHandler handler;
+    handler.Setup(orders[config], layers[config], 22);
+    uint64_t count = 0;
+    uint64_t hash = 1469598103934665603ULL;
+    while (handler.NextSolution()) {
+      std::ostringstream stream;
+      handler.CurrentSolution()->PrintTo(&stream);
+      stream << '\n';
+      const std::string &text = stream.str();
+      for (size_t index = 0; index < text.size(); ++index) {
+        hash ^= static_cast<unsigned char>(text[index]);
+        hash *= 1099511628211ULL;
+      }
+      ++count;
+    }
+    EXPECT_EQ(counts[config], count) << "config " << config;
+    EXPECT_EQ(hashes[config], hash) << "config " << config;
+  }
+}
+
+TEST(Split, Concatenation) {
+  for (int config = 0; config < kConfigs; ++config) {
+    Gauge::NVectorHandler handler;
+    handler.Setup(kOrders[config], kLayers[config], kSize);
+    std::vector<Gauge::NVector> expected;
+    Enumerate(&handler, &expected);
+
+    const int parts[] = { 1, 2, 3, 7 };
+    for (int part = 0; part < 4; ++part) {
+      std::vector<Gauge::NVectorSlice> slices(parts[part]);
+      handler.Split(parts[part], slices.data());
+      std::vector<Gauge::NVector> stream;
+      for (int index = 0; index < parts[part]; ++index) {
+        if (index > 0) {
+          EXPECT_EQ(slices[index - 1].end, slices[index].begin);
+        }
+        Gauge::NVectorHandler worker;
+        worker.Setup(slices[index]);
+        Enumerate(&worker, &stream);
+      }
+      EXPECT_TRUE(stream == expected) << "config " << config << ", "
+                                      << parts[part] << " parts";
+    }
+  }
+}
+
+TEST(Slice, Resume) {
+  Random::Seed();
+  for (int config = 0; config < kConfigs; ++config) {
+    Gauge::NVectorHandler handler;
+    handler.Setup(kOrders[config], kLayers[config], kSize);
+    std::vector<Gauge::NVector> expected;
+    Enumerate(&handler, &expected);
+
+    for (int trial = 0; trial < 5; ++trial) {
+      int pause = Random::Int(0, expected.size());
+      Gauge::NVectorHandler first;
+      first.Setup(kOrders[config], kLayers[config], kSize);
+      std::vector<Gauge::NVector> stream;
+      while (static_cast<int>(stream.size()) < pause && first.NextSolution())
+        stream.push_back(*first.CurrentSolution());
+
+      Gauge::NVectorSlice slice = first.Slice();
+      Gauge::Raw *raw = slice.Serialize();
+      Gauge::NVectorSlice resumed;
+      resumed.Deserialize(raw);
+      delete raw;
+
+      Gauge::NVectorHandler second;
+      second.Setup(resumed);
+      Enumerate(&second, &stream);
+      EXPECT_TRUE(stream == expected) << "config " << config << ", paused at "
+                                      << pause;
+    }
+  }
+}
+
+TEST(Count, Enumeration) {
+  const int configs = 16;
+  const int layers[configs] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3 };
+  const int orders[configs][3] = {
+    { 2, 0, 0 }, { 3, 0, 0 }, { 4, 0, 0 }, { 5, 0, 0 }, { 6, 0, 0 },
+    { 7, 0, 0 }, { 8, 0, 0 }, { 9, 0, 0 }, { 10, 0, 0 }, { 2, 2, 0 },
+    { 2, 3, 0 }, { 3, 2, 0 }, { 2, 4, 0 }, { 4, 2, 0 }, { 3, 3, 0 },
+    { 2, 2, 2 } };
+  const int sizes[] = { 22, 18 };
+  for (int config = 0; config < configs; ++config) {
+    for (int size = 0; size < 2; ++size) {
+      Gauge::NVectorHandler handler;
+      handler.Setup(orders[config], layers[config], sizes[size]);
+      uint64_t count = handler.Count();
+      uint64_t enumerated = 0;
+      while (handler.NextSolution()) ++enumerated;
+      EXPECT_EQ(enumerated, count) << "config " << config << ", size "
+                                   << sizes[size];
+
+      const int parts = 5;
+      Gauge::NVectorSlice slices[parts];
+      handler.Split(parts, slices);
+      uint64_t total = 0;
+      for (int index = 0; index < parts; ++index)
+        total += handler.Count(slices[index].begin, slices[index].end);
+      EXPECT_EQ(count, total);
+
+      handler.SplitByWeight(parts, slices);
+      total = 0;
+      for (int index = 0; index < parts; ++index) {
+        Gauge::NVectorHandler worker;
+        worker.Setup(slices[index]);
+        uint64_t weight = worker.Count();
+        uint64_t produced = 0;
+        while (worker.NextSolution()) ++produced;
+        EXPECT_EQ(produced, weight);
+        total += weight;
+      }
+      EXPECT_EQ(count, total);
+    }
+  }
+}
+
+TEST(DistributeArray, Collapse) {
+  /* A segment of a single element, as in segment 0 of a layer of even order
+   * with multiplicity one, has no other distribution and is left as is. */
+  int single[1] = { 5 };
+  const int none[3] = { -1, -1, -1 };
+  int first = -1;
+  EXPECT_FALSE(Distributor::DistributeArray(single, 1, none, &first));
+  EXPECT_EQ(5, single[0]);
+
+  /* Longer segments step through every distribution of their total and are
+   * then collapsed back onto their first element. */
+  int array[3] = { 2, 0, 0 };
+  int steps = 0;
+  while (Distributor::DistributeArray(array, 3, none, &first)) {
+    EXPECT_EQ(2, array[0] + array[1] + array[2]);
+    ++steps;
+  }
+  EXPECT_EQ(5, steps);
+  EXPECT_EQ(2, array[0]);
+  EXPECT_EQ(0, array[1]);
+  EXPECT_EQ(0, array[2]);
+}
+
+TEST(Setup, Reuse) {
+  /* One handler set up again and again, for the same orders and for others
+   * with more or fewer layers, enumerates what a fresh handler does. */
+  Gauge::NVectorHandler reused;
+  const int order[] = { 0, 0, 2, 2, 5, 3, 5, 0 };
+  for (size_t step = 0; step < sizeof(order) / sizeof(order[0]); ++step) {
+    int config = order[step];
+    reused.Setup(kOrders[config], kLayers[config], kSize);
+    std::vector<Gauge::NVector> stream;
+    Enumerate(&reused, &stream);
+
+    Gauge::NVectorHandler fresh;
+    fresh.Setup(kOrders[config], kLayers[config], kSize);
+    std::vector<Gauge::NVector> expected;
+    Enumerate(&fresh, &expected);
+    EXPECT_TRUE(stream == expected) << "step " << step;
+  }
+}
+
+TEST(Slice, Skip) {
+  /* A slice resumed at any position, up to the very end, produces the rest
+   * of the stream and then stays exhausted. */
+  for (int config = 0; config < kConfigs; ++config) {
+    Gauge::NVectorHandler handler;
+    handler.Setup(kOrders[config], kLayers[config], kSize);
+    std::vector<Gauge::NVector> expected;
+    Enumerate(&handler, &expected);
+    EXPECT_FALSE(handler.NextSolution());
+
+    uint64_t count = expected.size();
+    const uint64_t positions[] = { 1, count / 3, count - 1, count };
+    for (int index = 0; index < 4; ++index) {
+      Gauge::NVectorSlice slice(kOrders[config], kLayers[config], kSize, 0,
+                                UINT64_MAX);
+      slice.position = positions[index];
+      Gauge::NVectorHandler resumed;
+      resumed.Setup(slice);
+      std::vector<Gauge::NVector> stream;
+      Enumerate(&resumed, &stream);
+      EXPECT_TRUE(std::equal(stream.begin(), stream.end(),
+                             expected.begin() + positions[index]) &&
+                  stream.size() == count - positions[index])
+        << "config " << config << ", position " << positions[index];
+      EXPECT_FALSE(resumed.NextSolution());
+      EXPECT_EQ(count, resumed.Slice().position);
+    }
+  }
+}
@@ -0,0 +1,145 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file tests/src/NVectorSliceTest.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief This unittest is designed to define the operational parameters of the
+ * Gauge::NVectorSlice class.
+ */
+
+#include <gtest/gtest.h>
+#include <Random.h>
+
+TEST(Constructors, Default) {
+  Random::Seed();
+  for (int trial = 0; trial < 100; ++trial) {
+    Gauge::NVectorSlice *slice = new Gauge::NVectorSlice();
+    EXPECT_EQ(0, slice->layers);
+    EXPECT_EQ(NULL, slice->orders);
+    EXPECT_EQ(0, slice->size);
+    EXPECT_EQ(0u, slice->begin);
+    EXPECT_EQ(0u, slice->end);
+    EXPECT_EQ(0u, slice->position);
+    delete slice;
+  }
+}
+
+TEST(Constructors, Full) {
+  for (int trial = 0; trial < 100; ++trial) {
+    int layers = Random::Int(1,20);
+    int *orders = Random::IntArray(2,100,layers);
+    int size = Random::Int(16,23);
+    uint64_t begin = Random::Int(0,1000);
+    uint64_t end = begin + Random::Int(0,1000);
+    Gauge::NVectorSlice *slice =
+      new Gauge::NVectorSlice(orders, layers, size, begin, end);
+
+    EXPECT_EQ(layers, slice->layers);
+    for (int index = 0; index < layers; ++index) {
+      EXPECT_EQ(orders[index], slice->orders[index]);
+    }
+    EXPECT_EQ(size, slice->size);
+    EXPECT_EQ(begin, slice->begin);
+    EXPECT_EQ(end, slice->end);
+    EXPECT_EQ(0u, slice->position);
+
+    delete slice;
+    delete [] orders;
+  }
+}
+
+TEST(Constructors, Copy) {
+  for (int trial = 0; trial < 100; ++trial) {
+    Gauge::NVectorSlice *slice = Random::NVectorSlice();
+    Gauge::NVectorSlice *copy = new Gauge::NVectorSlice(*slice);
+
+    EXPECT_EQ(*slice, *copy);
+
+    delete slice;
+    delete copy;
+  }
+}
+
+TEST(Operators, Assignment) {
+  for (int trial = 0; trial < 100; ++trial) {
+    Gauge::NVectorSlice *slice = Random::NVectorSlice();
+    Gauge::NVectorSlice *other = Random::NVectorSlice();
+    Gauge::NVectorSlice copy = *other;
+    copy = *slice;
+
+    EXPECT_EQ(*slice, copy);
+
+    delete other;
+    delete slice;
+  }
+}
+
+TEST(Operators, Equals) {
+  for (int trial = 0; trial < 100; ++trial) {
+    Gauge::NVectorSlice *lhs = Random::NVectorSlice();
+    Gauge::NVectorSlice *rhs = new Gauge::NVectorSlice(*lhs);
+
+    EXPECT_TRUE(*lhs == *rhs);
+    ++rhs->position;
+    EXPECT_FALSE(*lhs == *rhs);
+    --rhs->position;
+    ++rhs->end;
+    EXPECT_FALSE(*lhs == *rhs);
+    --rhs->end;
+    ++rhs->orders[rhs->layers - 1];
+    EXPECT_FALSE(*lhs == *rhs);
+
+    delete rhs;
+    delete lhs;
+  }
+}
+
+TEST(Operators, NotEquals) {
+  for (int trial = 0; trial < 100; ++trial) {
+    Gauge::NVectorSlice *lhs = Random::NVectorSlice();
+    Gauge::NVectorSlice *rhs = new Gauge::NVectorSlice(*lhs);
+
+    EXPECT_FALSE(*lhs != *rhs);
+    ++rhs->begin;
+    EXPECT_TRUE(*lhs != *rhs);
+
+    delete rhs;
+    delete lhs;
+  }
+}
+
+TEST(SerialiableInterface, WriteReadInvariance) {
+  for (int trial = 0; trial < 100; ++trial) {
+    Gauge::NVectorSlice *input = Random::NVectorSlice();
+    Gauge::Raw *raw_input = input->Serialize();
+
+    Gauge::NVectorSlice *output = Random::NVectorSlice();
+    output->Deserialize(raw_input);
+
+    EXPECT_EQ(*input, *output);
+
+    EXPECT_EQ(0, raw_input->size);
+    EXPECT_EQ(NULL, raw_input->data);
+
+    delete output;
+    delete raw_input;
+    delete input;
+  }
+}
@@ -0,0 +1,69 @@
+/*
+ * This file is part of The Gauge Framework.
+ *
+ * The Gauge Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * The Gauge Framework is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with The Gauge Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * @file tests/src/StatisticsTest.cpp
+ * @author D. Moore <douglas_moore1@baylor.edu>
+ * @date 10.16.2026
+ *
+ * @brief This unittest is designed to define the operational parameters of the
+ * Gauge::Process::Statistics class.
+ */
+
+#include <gtest/gtest.h>
+
+#include <GeometryFactory.h>
+#include <InputFactory.h>
+#include <ModelFactory.h>
+#include <Processor/Statistics.h>
+
+namespace {
+  /* Two layers of one order, whose bases have symmetries. */
+  const int kLayers = 2;
+  const int kOrders[kLayers] = { 2, 2 };
+  const int kDimensions = 4;
+
+  /* Tallies the models of every Gauge::Geometry the factory produces, and
+   * returns the number of models built. */
+  uint64_t Tally(Gauge::GeometryFactory *factory,
+                 Gauge::Process::Statistics *statistics) {
+    factory->Setup(new Gauge::InputFactory::Single(kOrders, kLayers,
+          kDimensions, Gauge::Input::kSUSY));
+    Gauge::ModelFactory builder;
+    uint64_t built = 0;
+    while (factory->NextGeometry()) {
+      builder.Setup(factory->Geometry());
+      if (!builder.Build()) continue;
+      statistics->Process(builder.Model());
+      ++built;
+    }
+    return built;
+  }
+}
+
+TEST(Statistics, Permutation) {
+  Gauge::Process::Statistics plain, permuted;
+  Gauge::GeometryFactory *factory = Gauge::GeometryFactory::SystematicFactory();
+  uint64_t all = Tally(factory, &plain);
+  delete factory;
+  factory = Gauge::GeometryFactory::PermutationFactory();
+  uint64_t representatives = Tally(factory, &permuted);
+  delete factory;
+
+  EXPECT_LT(representatives, all);
+  EXPECT_TRUE(permuted == plain);
+}